@@ -1407,6 +1407,10 @@ SOURCE=.\src\bdd\reo\reoCore.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\bdd\reo\reoPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\bdd\reo\reoProfile.c
 # End Source File
 # Begin Source File
@@ -3115,6 +3119,10 @@ SOURCE=.\src\opt\dau\dau.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dau\dauCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dau\dauCanon.c
 # End Source File
 # Begin Source File
@@ -3207,6 +3215,10 @@ SOURCE=.\src\opt\sfm\sfmNtk.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\sfm\sfmPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\sfm\sfmSat.c
 # End Source File
 # Begin Source File
@@ -5271,6 +5283,10 @@ SOURCE=.\src\aig\gia\giaSim2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSimComp.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSimBase.c
 # End Source File
 # Begin Source File
@@ -5339,6 +5355,10 @@ SOURCE=.\src\aig\gia\giaTsim.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaTsim2.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaTtopt.cpp
 # End Source File
 # Begin Source File
@@ -5727,6 +5747,10 @@ SOURCE=.\src\proof\dch\dchMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\dch\dchPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\dch\dchSat.c
 # End Source File
 # Begin Source File
@@ -5923,6 +5947,10 @@ SOURCE=.\src\proof\int\intInter.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\int\intIncr.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\int\intM114.c
 # End Source File
 # Begin Source File
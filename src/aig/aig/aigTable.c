@@ -145,7 +145,7 @@ Aig_Obj_t * Aig_TableLookup( Aig_Man_t * p, Aig_Obj_t * pGhost )
 ***********************************************************************/
 Aig_Obj_t * Aig_TableLookupTwo( Aig_Man_t * p, Aig_Obj_t * pFanin0, Aig_Obj_t * pFanin1 )
 {
-    Aig_Obj_t * pGhost;
+    Aig_Obj_t Ghost, * pGhost = &Ghost;
     // consider simple cases
     if ( pFanin0 == pFanin1 )
         return pFanin0;
@@ -155,7 +155,13 @@ Aig_Obj_t * Aig_TableLookupTwo( Aig_Man_t * p, Aig_Obj_t * pFanin0, Aig_Obj_t *
         return pFanin0 == Aig_ManConst1(p) ? pFanin1 : Aig_ManConst0(p);
     if ( Aig_Regular(pFanin1) == Aig_ManConst1(p) )
         return pFanin1 == Aig_ManConst1(p) ? pFanin0 : Aig_ManConst0(p);
-    pGhost = Aig_ObjCreateGhost( p, pFanin0, pFanin1, AIG_OBJ_AND );
+    // use a local ghost, so that several threads can look up the same AIG
+    memset( pGhost, 0, sizeof(Aig_Obj_t) );
+    pGhost->Type = AIG_OBJ_AND;
+    if ( Aig_Regular(pFanin0)->Id < Aig_Regular(pFanin1)->Id )
+        pGhost->pFanin0 = pFanin0, pGhost->pFanin1 = pFanin1;
+    else
+        pGhost->pFanin0 = pFanin1, pGhost->pFanin1 = pFanin0;
     return Aig_TableLookup( p, pGhost );
 }
 
@@ -306,6 +306,8 @@ struct Gia_ParSim_t_
     int            RandSeed;      // seed to generate random numbers
     int            TimeLimit;     // time limit in seconds
     int            fCheckMiter;   // check if miter outputs are non-zero
+    int            fCompiled;     // uses the compiled simulator
+    int            nThreads;      // the number of threads (compiled simulator)
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
 };
@@ -1526,7 +1528,7 @@ extern Gia_Man_t *         Jf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pP
 extern Gia_Man_t *         Jf_ManDeriveCnf( Gia_Man_t * p, int fCnfObjIds );
 /*=== giaIso.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManIsoCanonicize( Gia_Man_t * p, int fVerbose );
-extern Gia_Man_t *         Gia_ManIsoReduce( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int fVerbose, int fVeryVerbose );
+extern Gia_Man_t *         Gia_ManIsoReduce( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int nThreads, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManIsoReduce2( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fBetterQual, int fDualOut, int fVerbose, int fVeryVerbose );
 /*=== giaLf.c ===========================================================*/
 extern void                Lf_ManSetDefaultPars( Jf_Par_t * pPars );
@@ -1725,6 +1727,17 @@ extern void                Gia_ObjComputeTruthTableStop( Gia_Man_t * p );
 extern word *              Gia_ObjComputeTruthTableCut( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vLeaves );
 /*=== giaTsim.c ============================================================*/
 extern Gia_Man_t *         Gia_ManReduceConst( Gia_Man_t * pAig, int fVerbose );
+/*=== giaTsim2.c ============================================================*/
+typedef struct Gia_Tsm_t_ Gia_Tsm_t;
+extern Gia_Tsm_t *         Gia_TsmStart( Gia_Man_t * pGia, int nWords );
+extern void                Gia_TsmStop( Gia_Tsm_t * p );
+extern void                Gia_TsmSetCi( Gia_Tsm_t * p, int iObj, int Value );
+extern void                Gia_TsmSetCiPat( Gia_Tsm_t * p, int iObj, int iPat, int Value );
+extern int                 Gia_TsmObjValue( Gia_Tsm_t * p, int iObj, int iPat );
+extern void                Gia_TsmSimulate( Gia_Tsm_t * p, Vec_Int_t * vObjs );
+extern int                 Gia_TsmSimulateTfo( Gia_Tsm_t * p, Vec_Int_t * vCis );
+extern int                 Gia_TsmBinaryMask( Gia_Tsm_t * p, Vec_Int_t * vObjs, word * pMask );
+extern int                 Gia_TsmFindDrops( Gia_Tsm_t * p, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vCoObjs, Vec_Int_t * vCands, Vec_Int_t * vDrops );
 /*=== giaUtil.c ===========================================================*/
 extern unsigned            Gia_ManRandom( int fReset );
 extern word                Gia_ManRandomW( int fReset );
@@ -1795,11 +1808,19 @@ extern Vec_Int_t *         Gia_ManComputeDistance( Gia_Man_t * p, int iObj, Vec_
 
 /*=== giaTtopt.cpp ===========================================================*/
 extern Gia_Man_t *         Gia_ManTtopt( Gia_Man_t * p, int nIns, int nOuts, int nRounds );
+extern Gia_Man_t *         Gia_ManTtoptPar( Gia_Man_t * p, int nIns, int nOuts, int nRounds, int nThreads );
 extern Gia_Man_t *         Gia_ManTtoptCare( Gia_Man_t * p, int nIns, int nOuts, int nRounds, char * pFileName, int nRarity );
 
 /*=== giaTransduction.cpp ===========================================================*/
 extern Gia_Man_t *         Gia_ManTransductionBdd( Gia_Man_t * pGia, int nType, int fMspf, int nRandom, int nSortType, int nPiShuffle, int nParameter, int fLevel, Gia_Man_t * pExdc, int fNewLine, int nVerbose );
 extern Gia_Man_t *         Gia_ManTransductionTt( Gia_Man_t * pGia, int nType, int fMspf, int nRandom, int nSortType, int nPiShuffle, int nParameter, int fLevel, Gia_Man_t * pExdc, int fNewLine, int nVerbose );
+extern Gia_Man_t *         Gia_ManTransductionWin( Gia_Man_t * pGia, int nType, int fMspf, int nRandom, int nSortType, int nPiShuffle, int nParameter, int fLevel, int fTruth, int nWinSize, int nThreads, int fNewLine, int nVerbose );
+/*=== giaStoch.c ===========================================================*/
+extern Vec_Wec_t *         Gia_ManStochNodes( Gia_Man_t * p, int nMaxSize, int Seed );
+extern Vec_Wec_t *         Gia_ManStochInputs( Gia_Man_t * p, Vec_Wec_t * vAnds );
+extern Vec_Wec_t *         Gia_ManStochOutputs( Gia_Man_t * p, Vec_Wec_t * vAnds );
+extern Gia_Man_t *         Gia_ManDupDivideOne( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos );
+extern Gia_Man_t *         Gia_ManDupStitch( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, Vec_Ptr_t * vAigs, int fHash );
 
 /*=== giaCTas.c ===========================================================*/
 typedef struct Tas_Man_t_  Tas_Man_t;
@@ -20,6 +20,17 @@
 
 #include "gia.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
  
 
@@ -1035,6 +1046,113 @@ Vec_Str_t * Gia_ManIsoFindString( Gia_Man_t * p, int iPo, int fVerbose, Vec_Int_
     return vStr;
 }
 
+#ifdef ABC_USE_PTHREADS
+
+#define GIA_ISO_PAR_MAX 64
+
+// the data of one thread deriving canonical strings
+typedef struct Gia_IsoThData_t_
+{
+    Gia_Man_t *       p;          // the copy of the AIG owned by this thread
+    Vec_Int_t *       vPos;       // the POs whose strings are needed (shared)
+    Vec_Str_t **      pStrs;      // the resulting strings (indexed by PO)
+    Vec_Int_t **      pPerms;     // the resulting PI permutations or NULL
+    volatile int *    piNext;     // the next PO in vPos to be processed
+    pthread_mutex_t * pMutex;     // protects piNext
+} Gia_IsoThData_t;
+
+void * Gia_ManIsoFindStringsThread( void * pArg )
+{
+    Gia_IsoThData_t * pThData = (Gia_IsoThData_t *)pArg;
+    int i, iPo;
+    while ( 1 )
+    {
+        pthread_mutex_lock( pThData->pMutex );
+        i = (*pThData->piNext)++;
+        pthread_mutex_unlock( pThData->pMutex );
+        if ( i >= Vec_IntSize(pThData->vPos) )
+            break;
+        iPo = Vec_IntEntry( pThData->vPos, i );
+        pThData->pStrs[iPo] = Gia_ManIsoFindString( pThData->p, iPo, 0, pThData->pPerms ? pThData->pPerms + iPo : NULL );
+    }
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Derives canonical strings for the given POs.]
+
+  Description [The cones of the POs are canonicized independently, so
+  several threads may work on them at the same time, each taking the
+  next PO as soon as it is done with the previous one. Every thread
+  works on its own copy of the AIG because duplicating the cones
+  changes the traversal IDs and the values of the objects.
+  The strings are stored in pStrs and the permutations (if pPerms is
+  not NULL) in pPerms, both indexed by the PO number.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManIsoFindStrings( Gia_Man_t * p, Vec_Int_t * vPos, Vec_Str_t ** pStrs, Vec_Int_t ** pPerms, int nThreads )
+{
+    int i, iPo;
+#ifdef ABC_USE_PTHREADS
+    nThreads = Abc_MinInt( nThreads, Abc_MinInt(Vec_IntSize(vPos), GIA_ISO_PAR_MAX) );
+    if ( nThreads > 1 )
+    {
+        Gia_IsoThData_t ThData[GIA_ISO_PAR_MAX];
+        pthread_t WorkerThread[GIA_ISO_PAR_MAX];
+        pthread_mutex_t Mutex;
+        volatile int iNext = 0;
+        int k, status;
+        pthread_mutex_init( &Mutex, NULL );
+        for ( k = 0; k < nThreads; k++ )
+        {
+            ThData[k].p      = Gia_ManDup( p );
+            ThData[k].vPos   = vPos;
+            ThData[k].pStrs  = pStrs;
+            ThData[k].pPerms = pPerms;
+            ThData[k].piNext = &iNext;
+            ThData[k].pMutex = &Mutex;
+            status = pthread_create( WorkerThread + k, NULL, Gia_ManIsoFindStringsThread, (void *)(ThData + k) );  assert( status == 0 );
+        }
+        for ( k = 0; k < nThreads; k++ )
+        {
+            status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+            Gia_ManStop( ThData[k].p );
+        }
+        pthread_mutex_destroy( &Mutex );
+        return;
+    }
+#endif
+    Vec_IntForEachEntry( vPos, iPo, i )
+        pStrs[iPo] = Gia_ManIsoFindString( p, iPo, 0, pPerms ? pPerms + iPo : NULL );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashes the canonical string.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManIsoStringHash( Vec_Str_t * vStr )
+{
+    unsigned Key = 0;
+    int i;
+    for ( i = 0; i < Vec_StrSize(vStr); i++ )
+        Key = Key * 0x9E3779B1 + (unsigned char)Vec_StrEntry(vStr, i) + s_256Primes[i & ISO_MASK];
+    return (int)(Key & 0x7FFFFFFF);
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1072,13 +1190,13 @@ int Vec_IntCountNonTrivial( Vec_Ptr_t * vEquivs, int * pnUsed )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int fVerbose, int fVeryVerbose )
+Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int nThreads, int fVerbose, int fVeryVerbose )
 { 
     Gia_Man_t * p, * pPart;
     Vec_Ptr_t * vEquivs, * vEquivs2, * vStrings;
-    Vec_Int_t * vRemain, * vLevel, * vLevel2;
-    Vec_Str_t * vStr, * vStr2;
-    int i, k, s, sStart, iPo, Counter;
+    Vec_Int_t * vRemain, * vLevel, * vLevel2, * vPos, * vHashes;
+    Vec_Str_t * vStr, * vStr2, ** pStrs;
+    int i, k, s, sStart, iPo, Counter, Hash;
     int nClasses, nUsedPos;
     abctime clk = Abc_Clock();
     if ( pvPosEquivs )
@@ -1120,8 +1238,21 @@ Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_P
         return Gia_ManDup(pInit);
     }
 
+    // derive canonical strings of the POs in non-trivial classes
+    vPos = Vec_IntAlloc( Gia_ManPoNum(p) );
+    Vec_PtrForEachEntry( Vec_Int_t *, vEquivs, vLevel, i )
+        if ( Vec_IntSize(vLevel) >= 2 )
+            Vec_IntAppend( vPos, vLevel );
+    pStrs = ABC_CALLOC( Vec_Str_t *, Gia_ManPoNum(p) );
+    if ( pvPiPerms )
+        Vec_IntForEachEntry( vPos, iPo, i )
+            assert( Vec_PtrArray(*pvPiPerms)[iPo] == NULL );
+    Gia_ManIsoFindStrings( p, vPos, pStrs, pvPiPerms ? (Vec_Int_t **)Vec_PtrArray(*pvPiPerms) : NULL, nThreads );
+    Vec_IntFree( vPos );
+
     // perform refinement of equivalence classes
     Counter = 0;
+    vHashes = Vec_IntAlloc( 100 );
     vEquivs2 = Vec_PtrAlloc( 100 );
     Vec_PtrForEachEntry( Vec_Int_t *, vEquivs, vLevel, i )
     {
@@ -1145,23 +1276,26 @@ Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_P
 
         sStart = Vec_PtrSize( vEquivs2 ); 
         vStrings = Vec_PtrAlloc( 100 );
+        Vec_IntClear( vHashes );
         Vec_IntForEachEntry( vLevel, iPo, k )
         {
             if ( ++Counter % 100 == 0 )
                 printf( "%6d finished...\r", Counter );
-            assert( pvPiPerms == NULL || Vec_PtrArray(*pvPiPerms)[iPo] == NULL );
-            vStr = Gia_ManIsoFindString( p, iPo, 0, pvPiPerms ? (Vec_Int_t **)Vec_PtrArray(*pvPiPerms) + iPo : NULL );
+            vStr = pStrs[iPo];
+            pStrs[iPo] = NULL;
 
 //            printf( "Output %2d : ", iPo );
 //            Vec_IntPrint( Vec_PtrArray(*pvPiPerms)[iPo] );
 
             // check if this string already exists
+            Hash = Gia_ManIsoStringHash( vStr );
             Vec_PtrForEachEntry( Vec_Str_t *, vStrings, vStr2, s )
-                if ( Vec_StrCompareVec(vStr, vStr2) == 0 )
+                if ( Vec_IntEntry(vHashes, s) == Hash && Vec_StrCompareVec(vStr, vStr2) == 0 )
                     break;
             if ( s == Vec_PtrSize(vStrings) )
             {
                 Vec_PtrPush( vStrings, vStr );
+                Vec_IntPush( vHashes, Hash );
                 Vec_PtrPush( vEquivs2, Vec_IntAlloc(8) );
             }
             else
@@ -1175,6 +1309,8 @@ Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_P
         Vec_VecFree( (Vec_Vec_t *)vStrings );
     }
     assert( Counter == Gia_ManPoNum(p) );
+    Vec_IntFree( vHashes );
+    ABC_FREE( pStrs );
     Vec_VecSortByFirstInt( (Vec_Vec_t *)vEquivs2, 0 );
     Vec_VecFree( (Vec_Vec_t *)vEquivs );
     vEquivs = vEquivs2;
@@ -1296,7 +1432,7 @@ void Gia_IsoTest( Gia_Man_t * p, Abc_Cex_t * pCex, int fVerbose )
 //Gia_AigerWrite( pDouble, "test.aig", 0, 0, 0 );
 
     // analyze the two-output miter
-    pAig = Gia_ManIsoReduce( pDouble, &vPosEquivs, &vPisPerm, 0, 0, 0, 0 );
+    pAig = Gia_ManIsoReduce( pDouble, &vPosEquivs, &vPisPerm, 0, 0, 1, 0, 0 );
     Vec_VecFree( (Vec_Vec_t *)vPosEquivs );
 
     // given CEX for output 0, derive CEX for output 1
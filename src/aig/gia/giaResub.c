@@ -833,16 +833,19 @@ static inline int Gia_ManFindFirstCommonLit( Vec_Int_t * vArr1, Vec_Int_t * vArr
 
 void Gia_ManFindOneUnateInt( word * pOff, word * pOn, Vec_Ptr_t * vDivs, int nWords, Vec_Int_t * vUnateLits, Vec_Int_t * vNotUnateVars )
 {
-    word * pDiv; int i;
+    word * pDiv; int i, Mask;
     Vec_IntClear( vUnateLits );
     Vec_IntClear( vNotUnateVars );
     Vec_PtrForEachEntryStart( word *, vDivs, pDiv, i, 2 )
-        if ( !Abc_TtIntersectOne( pOff, 0, pDiv, 0, nWords ) )
+    {
+        Mask = Abc_TtIntersectOnePolar( pOff, pDiv, nWords );
+        if ( !(Mask & 1) )
             Vec_IntPush( vUnateLits, Abc_Var2Lit(i, 0) );
-        else if ( !Abc_TtIntersectOne( pOff, 0, pDiv, 1, nWords ) )
+        else if ( !(Mask & 2) )
             Vec_IntPush( vUnateLits, Abc_Var2Lit(i, 1) );
         else
             Vec_IntPush( vNotUnateVars, i );
+    }
 }
 int Gia_ManFindOneUnate( word * pSets[2], Vec_Ptr_t * vDivs, int nWords, Vec_Int_t * vUnateLits[2], Vec_Int_t * vNotUnateVars[2], int fVerbose )
 {
@@ -912,9 +915,10 @@ void Gia_ManFindXorInt( word * pOff, word * pOn, Vec_Int_t * vBinate, Vec_Ptr_t
         int iDiv1 = Abc_MaxInt( iDiv0_, iDiv1_ );
         word * pDiv0 = (word *)Vec_PtrEntry(vDivs, iDiv0);
         word * pDiv1 = (word *)Vec_PtrEntry(vDivs, iDiv1);
-        if ( !Abc_TtIntersectXor( pOff, 0, pDiv0, pDiv1, 0, nWords ) )
+        int Mask = Abc_TtIntersectXorPolar( pOff, pDiv0, pDiv1, nWords );
+        if ( !(Mask & 1) )
             Vec_IntPush( vUnatePairs, Abc_Var2Lit((Abc_Var2Lit(iDiv0, 0) << 15) | Abc_Var2Lit(iDiv1, 0), 0) );
-        else if ( !Abc_TtIntersectXor( pOff, 0, pDiv0, pDiv1, 1, nWords ) )
+        else if ( !(Mask & 2) )
             Vec_IntPush( vUnatePairs, Abc_Var2Lit((Abc_Var2Lit(iDiv0, 0) << 15) | Abc_Var2Lit(iDiv1, 0), 1) );
     }
 }
@@ -942,12 +946,14 @@ void Gia_ManFindUnatePairsInt( word * pOff, word * pOn, Vec_Int_t * vBinate, Vec
         int iDiv1 = Abc_MaxInt( iDiv0_, iDiv1_ );
         word * pDiv0 = (word *)Vec_PtrEntry(vDivs, iDiv0);
         word * pDiv1 = (word *)Vec_PtrEntry(vDivs, iDiv1);
+        // the polarities that do not intersect the offset and intersect the onset
+        int MaskOff = Abc_TtIntersectTwoPolar( pOff, pDiv0, pDiv1, 15, nWords );
+        int MaskOn  = MaskOff == 15 ? 0 : Abc_TtIntersectTwoPolar( pOn, pDiv0, pDiv1, ~MaskOff & 15, nWords );
         for ( n = 0; n < 4; n++ )
         {
             int iLit0 = Abc_Var2Lit( iDiv0, n&1 );
             int iLit1 = Abc_Var2Lit( iDiv1, n>>1 );
-            //if ( !Abc_TtIntersectTwo( pOff, 0, pDiv1, n>>1, pDiv0, n&1, nWords ) )
-            if ( !Abc_TtIntersectTwo( pOff, 0, pDiv1, n>>1, pDiv0, n&1, nWords ) && Abc_TtIntersectTwo( pOn, 0, pDiv1, n>>1, pDiv0, n&1, nWords ) )
+            if ( !((MaskOff >> n) & 1) && ((MaskOn >> n) & 1) )
                 Vec_IntPush( vUnatePairs, Abc_Var2Lit((iLit1 << 15) | iLit0, 0) );
         }
     }
@@ -171,6 +171,8 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->RandSeed     =   0;    // the seed to generate random numbers
     p->TimeLimit    =  60;    // time limit in seconds
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
+    p->fCompiled    =   0;    // uses the compiled simulator
+    p->nThreads     =   1;    // the number of threads (compiled simulator)
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
 }
@@ -599,12 +601,15 @@ void Gia_ManResetRandom( Gia_ParSim_t * pPars )
 int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
 {
     extern int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
+    extern int Gia_ManSimSimulateCompiled( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
     Gia_ManSim_t * p;
     abctime clkTotal = Abc_Clock();
     int i, iOut, iPat, RetValue = 0;
     abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
     if ( pAig->pReprs && pAig->pNexts )
         return Gia_ManSimSimulateEquiv( pAig, pPars );
+    if ( pPars->fCompiled )
+        return Gia_ManSimSimulateCompiled( pAig, pPars );
     ABC_FREE( pAig->pCexSeq );
     p = Gia_ManSimCreate( pAig, pPars );
     Gia_ManResetRandom( pPars );
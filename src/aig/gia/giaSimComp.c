@@ -0,0 +1,520 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimComp.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Compiled sequential simulator.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_SIM_PAR_MAX 64
+
+// the AIG compiled into a flat instruction stream
+//
+// The simulation data has one slot for each of the following objects
+// (in this order): constant 0, PIs, flop outputs, AND nodes sorted by
+// level, POs, flop inputs. Instruction i computes the AND node in slot
+// iFirstAnd+i from the slots pFan0[i] and pFan1[i] complemented using
+// masks pMask0[i] and pMask1[i]. The COs are computed by copying.
+typedef struct Gia_SimProg_t_ Gia_SimProg_t;
+struct Gia_SimProg_t_
+{
+    Gia_Man_t *    pAig;         // the AIG
+    int            nPis;         // the number of PIs
+    int            nRegs;        // the number of flops
+    int            nPos;         // the number of POs
+    int            nAnds;        // the number of AND nodes
+    int            nLevels;      // the number of logic levels
+    int            iFirstAnd;    // the first slot of AND nodes
+    int            iFirstCo;     // the first slot of COs
+    int            nSlots;       // the total number of slots
+    int *          pFan0;        // the first fanin slots of AND nodes
+    int *          pFan1;        // the second fanin slots of AND nodes
+    word *         pMask0;       // the first complement masks of AND nodes
+    word *         pMask1;       // the second complement masks of AND nodes
+    int *          pCoFan;       // the fanin slots of COs
+    word *         pCoMask;      // the complement masks of COs
+};
+
+// the simulation of a range of patterns
+typedef struct Gia_SimThr_t_ Gia_SimThr_t;
+struct Gia_SimThr_t_
+{
+    Gia_SimProg_t * pProg;       // the shared program
+    Gia_ParSim_t *  pPars;       // the parameters
+    int             iWordStart;  // the first word of this range
+    int             nWords;      // the number of words in this range
+    word *          pSims;       // the simulation data (nSlots * nWords)
+    word *          pRands;      // the random number generator states (nWords)
+    abctime         TimeStop;    // the time to stop
+    int *           pFrameFail;  // the earliest failed frame found by any thread
+    int             iFrame;      // the failed frame (or the number of simulated frames)
+    int             iOut;        // the failed output
+    int             iPat;        // the failed pattern
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t * pMutex;    // protects pFrameFail
+#endif
+};
+
+static inline word * Gia_SimThrData( Gia_SimThr_t * p, int iSlot )  { return p->pSims + (size_t)iSlot * p->nWords; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Compiles the AIG into the instruction stream.]
+
+  Description [AND nodes are sorted by level (and by ID within a level),
+  so that the nodes of the same level are stored contiguously.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_SimProg_t * Gia_SimProgCompile( Gia_Man_t * pAig )
+{
+    Gia_SimProg_t * p;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vLevels, * vStarts;
+    int * pSlots;
+    int i, k, Level;
+    p = ABC_CALLOC( Gia_SimProg_t, 1 );
+    p->pAig      = pAig;
+    p->nPis      = Gia_ManPiNum(pAig);
+    p->nRegs     = Gia_ManRegNum(pAig);
+    p->nPos      = Gia_ManPoNum(pAig);
+    p->nAnds     = Gia_ManAndNum(pAig);
+    p->iFirstAnd = 1 + Gia_ManCiNum(pAig);
+    p->iFirstCo  = p->iFirstAnd + p->nAnds;
+    p->nSlots    = p->iFirstCo + Gia_ManCoNum(pAig);
+    // compute levels
+    vLevels = Vec_IntStart( Gia_ManObjNum(pAig) );
+    Gia_ManForEachAnd( pAig, pObj, i )
+    {
+        Level = 1 + Abc_MaxInt( Vec_IntEntry(vLevels, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevels, Gia_ObjFaninId1(pObj, i)) );
+        Vec_IntWriteEntry( vLevels, i, Level );
+        p->nLevels = Abc_MaxInt( p->nLevels, Level );
+    }
+    // count nodes by level and find the first slot of each level
+    vStarts = Vec_IntStart( p->nLevels + 2 );
+    Gia_ManForEachAnd( pAig, pObj, i )
+        Vec_IntAddToEntry( vStarts, Vec_IntEntry(vLevels, i) + 1, 1 );
+    Vec_IntWriteEntry( vStarts, 1, p->iFirstAnd );
+    for ( k = 2; k <= p->nLevels + 1; k++ )
+        Vec_IntAddToEntry( vStarts, k, Vec_IntEntry(vStarts, k-1) );
+    // assign slots
+    pSlots = ABC_FALLOC( int, Gia_ManObjNum(pAig) );
+    pSlots[0] = 0;
+    Gia_ManForEachCi( pAig, pObj, i )
+        pSlots[Gia_ObjId(pAig, pObj)] = 1 + i;
+    Gia_ManForEachAnd( pAig, pObj, i )
+    {
+        Level = Vec_IntEntry( vLevels, i );
+        pSlots[i] = Vec_IntEntry( vStarts, Level );
+        Vec_IntAddToEntry( vStarts, Level, 1 );
+    }
+    // write the instructions
+    p->pFan0  = ABC_ALLOC( int,  p->nAnds );
+    p->pFan1  = ABC_ALLOC( int,  p->nAnds );
+    p->pMask0 = ABC_ALLOC( word, p->nAnds );
+    p->pMask1 = ABC_ALLOC( word, p->nAnds );
+    Gia_ManForEachAnd( pAig, pObj, i )
+    {
+        k = pSlots[i] - p->iFirstAnd;
+        p->pFan0[k]  = pSlots[Gia_ObjFaninId0(pObj, i)];
+        p->pFan1[k]  = pSlots[Gia_ObjFaninId1(pObj, i)];
+        p->pMask0[k] = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        p->pMask1[k] = Gia_ObjFaninC1(pObj) ? ~(word)0 : 0;
+        assert( p->pFan0[k] < pSlots[i] && p->pFan1[k] < pSlots[i] );
+    }
+    p->pCoFan  = ABC_ALLOC( int,  Gia_ManCoNum(pAig) );
+    p->pCoMask = ABC_ALLOC( word, Gia_ManCoNum(pAig) );
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        p->pCoFan[i]  = pSlots[Gia_ObjFaninId0p(pAig, pObj)];
+        p->pCoMask[i] = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+    }
+    ABC_FREE( pSlots );
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vLevels );
+    return p;
+}
+void Gia_SimProgFree( Gia_SimProg_t * p )
+{
+    ABC_FREE( p->pFan0 );
+    ABC_FREE( p->pFan1 );
+    ABC_FREE( p->pMask0 );
+    ABC_FREE( p->pMask1 );
+    ABC_FREE( p->pCoFan );
+    ABC_FREE( p->pCoMask );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Random number generator of one pattern word.]
+
+  Description [Each word of patterns has its own generator, so the patterns
+  do not depend on how the words are distributed among the threads, and
+  the counter-example can be recomputed from the word index.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Gia_SimProgRandomSeed( int RandSeed, int iWord )
+{
+    word x = (word)(RandSeed + 1) * ABC_CONST(0x9E3779B97F4A7C15) + (word)(iWord + 1) * ABC_CONST(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 30)) * ABC_CONST(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * ABC_CONST(0x94D049BB133111EB);
+    x ^= x >> 31;
+    return x ? x : ABC_CONST(0x9E3779B97F4A7C15);
+}
+static inline word Gia_SimProgRandom( word * pState )
+{
+    word x = *pState;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *pState = x;
+    return x * ABC_CONST(0x2545F4914F6CDD1D);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Executes the program for one frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimProgRunFrame( Gia_SimThr_t * p )
+{
+    Gia_SimProg_t * pProg = p->pProg;
+    int * pFan0 = pProg->pFan0, * pFan1 = pProg->pFan1;
+    word * pMask0 = pProg->pMask0, * pMask1 = pProg->pMask1;
+    word * pOut, * pIn0, * pIn1, Mask0, Mask1;
+    int i, w, nWords = p->nWords;
+    // generate the PI values
+    pOut = Gia_SimThrData( p, 1 );
+    for ( i = 0; i < pProg->nPis; i++, pOut += nWords )
+        for ( w = 0; w < nWords; w++ )
+            pOut[w] = Gia_SimProgRandom( p->pRands + w );
+    // execute the instructions
+    pOut = Gia_SimThrData( p, pProg->iFirstAnd );
+    for ( i = 0; i < pProg->nAnds; i++, pOut += nWords )
+    {
+        pIn0  = Gia_SimThrData( p, pFan0[i] );
+        pIn1  = Gia_SimThrData( p, pFan1[i] );
+        Mask0 = pMask0[i];
+        Mask1 = pMask1[i];
+        for ( w = 0; w < nWords; w++ )
+            pOut[w] = (pIn0[w] ^ Mask0) & (pIn1[w] ^ Mask1);
+    }
+    // compute the COs
+    pOut = Gia_SimThrData( p, pProg->iFirstCo );
+    for ( i = 0; i < pProg->nPos + pProg->nRegs; i++, pOut += nWords )
+    {
+        pIn0  = Gia_SimThrData( p, pProg->pCoFan[i] );
+        Mask0 = pProg->pCoMask[i];
+        for ( w = 0; w < nWords; w++ )
+            pOut[w] = pIn0[w] ^ Mask0;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the first PO and pattern that failed.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_SimProgCheckPos( Gia_SimThr_t * p, int * piPo, int * piPat )
+{
+    word * pInfo = Gia_SimThrData( p, p->pProg->iFirstCo );
+    int i, w;
+    for ( i = 0; i < p->pProg->nPos; i++, pInfo += p->nWords )
+        for ( w = 0; w < p->nWords; w++ )
+            if ( pInfo[w] )
+            {
+                *piPo  = i;
+                *piPat = 64 * (p->iWordStart + w) + Abc_Tt6FirstBit( pInfo[w] );
+                return 1;
+            }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one range of patterns.]
+
+  Description [Stops when a PO fails, when the frame limit or the time
+  limit is reached, or when another thread has found a failure in an
+  earlier frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimProgRunRange( Gia_SimThr_t * p )
+{
+    Gia_SimProg_t * pProg = p->pProg;
+    size_t nRegWords = (size_t)pProg->nRegs * p->nWords;
+    int f, w, FrameFail;
+    // the constant and the flop outputs are zero
+    memset( Gia_SimThrData(p, 0), 0, sizeof(word) * p->nWords );
+    memset( Gia_SimThrData(p, 1 + pProg->nPis), 0, sizeof(word) * nRegWords );
+    for ( w = 0; w < p->nWords; w++ )
+        p->pRands[w] = Gia_SimProgRandomSeed( p->pPars->RandSeed, p->iWordStart + w );
+    p->iOut = p->iPat = -1;
+    for ( f = 0; f < p->pPars->nIters; f++ )
+    {
+#ifdef ABC_USE_PTHREADS
+        if ( p->pMutex ) pthread_mutex_lock( p->pMutex );
+#endif
+        FrameFail = *p->pFrameFail;
+#ifdef ABC_USE_PTHREADS
+        if ( p->pMutex ) pthread_mutex_unlock( p->pMutex );
+#endif
+        if ( FrameFail < f )
+            break;
+        Gia_SimProgRunFrame( p );
+        if ( p->pPars->fCheckMiter && Gia_SimProgCheckPos( p, &p->iOut, &p->iPat ) )
+        {
+#ifdef ABC_USE_PTHREADS
+            if ( p->pMutex ) pthread_mutex_lock( p->pMutex );
+#endif
+            *p->pFrameFail = Abc_MinInt( *p->pFrameFail, f );
+#ifdef ABC_USE_PTHREADS
+            if ( p->pMutex ) pthread_mutex_unlock( p->pMutex );
+#endif
+            break;
+        }
+        if ( p->TimeStop && Abc_Clock() > p->TimeStop )
+        {
+            f++;
+            break;
+        }
+        // transfer the flop inputs to the flop outputs
+        memcpy( Gia_SimThrData(p, 1 + pProg->nPis), Gia_SimThrData(p, pProg->iFirstCo + pProg->nPos), sizeof(word) * nRegWords );
+    }
+    p->iFrame = f;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Thread procedure.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_SimProgThread( void * pArg )
+{
+    Gia_SimProgRunRange( (Gia_SimThr_t *)pArg );
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example for the given pattern.]
+
+  Description [Replays the random number generator of the pattern's word.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Gia_SimProgGenerateCounter( Gia_Man_t * pAig, int RandSeed, int iFrame, int iOut, int iPat )
+{
+    Abc_Cex_t * p;
+    word State = Gia_SimProgRandomSeed( RandSeed, iPat / 64 );
+    int f, i, Counter;
+    p = Abc_CexAlloc( Gia_ManRegNum(pAig), Gia_ManPiNum(pAig), iFrame+1 );
+    p->iFrame = iFrame;
+    p->iPo    = iOut;
+    Counter   = p->nRegs;
+    for ( f = 0; f <= iFrame; f++ )
+        for ( i = 0; i < Gia_ManPiNum(pAig); i++, Counter++ )
+            if ( (Gia_SimProgRandom( &State ) >> (iPat % 64)) & 1 )
+                Abc_InfoSetBit( p->pData, Counter );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs random simulation using the compiled AIG.]
+
+  Description [The AIG is compiled once into a levelized instruction
+  stream, which is then executed in each frame by a tight loop over the
+  pattern words. The words are divided among pPars->nThreads threads,
+  each of which simulates its patterns independently. The flops are
+  updated by copying the block of flop inputs into the block of flop
+  outputs. Here pPars->nWords is the number of 64-bit words. The result
+  does not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimSimulateCompiled( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
+{
+    Gia_SimThr_t Thrs[GIA_SIM_PAR_MAX];
+    Gia_SimProg_t * pProg;
+    abctime clkTotal = Abc_Clock();
+    int nThreads = Abc_MaxInt( 1, Abc_MinInt( Abc_MinInt(pPars->nThreads, GIA_SIM_PAR_MAX), pPars->nWords ) );
+    int nWordsThr = (pPars->nWords + nThreads - 1) / Abc_MaxInt( 1, nThreads );
+    int i, iFrames, iBest = -1, FrameFail = ABC_INFINITY, RetValue = 0;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;
+#endif
+    ABC_FREE( pAig->pCexSeq );
+    if ( pPars->nWords == 0 )
+    {
+        Abc_Print( 1, "No patterns to simulate.\n" );
+        return 0;
+    }
+    pProg = Gia_SimProgCompile( pAig );
+    nThreads = (pPars->nWords + nWordsThr - 1) / nWordsThr;
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Compiled %d nodes on %d levels.  Threads = %d.  Sim mem = %.2f MB.  ",
+            pProg->nAnds, pProg->nLevels, nThreads, 8.0 * pPars->nWords * pProg->nSlots / (1<<20) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    }
+    memset( Thrs, 0, sizeof(Gia_SimThr_t) * nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Thrs[i].pProg      = pProg;
+        Thrs[i].pPars      = pPars;
+        Thrs[i].iWordStart = i * nWordsThr;
+        Thrs[i].nWords     = Abc_MinInt( nWordsThr, pPars->nWords - i * nWordsThr );
+        Thrs[i].pSims      = ABC_ALLOC( word, (size_t)pProg->nSlots * Thrs[i].nWords );
+        Thrs[i].pRands     = ABC_ALLOC( word, Thrs[i].nWords );
+        Thrs[i].TimeStop   = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock() : 0;
+        Thrs[i].pFrameFail = &FrameFail;
+        if ( Thrs[i].pSims == NULL )
+        {
+            Abc_Print( 1, "Simulator could not allocate %.2f GB for simulation info.\n", 8.0 * pPars->nWords * pProg->nSlots / (1<<30) );
+            for ( i = 0; i < nThreads; i++ )
+            {
+                ABC_FREE( Thrs[i].pSims );
+                ABC_FREE( Thrs[i].pRands );
+            }
+            Gia_SimProgFree( pProg );
+            return 0;
+        }
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[GIA_SIM_PAR_MAX];
+        int status;
+        pthread_mutex_init( &Mutex, NULL );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            Thrs[i].pMutex = &Mutex;
+            status = pthread_create( WorkerThread + i, NULL, Gia_SimProgThread, (void *)(Thrs + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        pthread_mutex_destroy( &Mutex );
+    }
+    else
+#endif
+    Gia_SimProgRunRange( Thrs );
+    // select the earliest failure (the first output and pattern among equal frames)
+    iFrames = pPars->nIters;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        iFrames = Abc_MinInt( iFrames, Thrs[i].iFrame );
+        if ( Thrs[i].iOut == -1 )
+            continue;
+        if ( iBest == -1 || Thrs[i].iFrame < Thrs[iBest].iFrame ||
+            (Thrs[i].iFrame == Thrs[iBest].iFrame && Thrs[i].iOut < Thrs[iBest].iOut) )
+            iBest = i;
+    }
+    if ( iBest >= 0 )
+    {
+        Gia_SimThr_t * pBest = Thrs + iBest;
+        pPars->iOutFail = pBest->iOut;
+        pAig->pCexSeq = Gia_SimProgGenerateCounter( pAig, pPars->RandSeed, pBest->iFrame, pBest->iOut, pBest->iPat );
+        Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", pBest->iOut, pAig->pName, pBest->iFrame );
+        if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
+            Abc_Print( 1, "\nGenerated counter-example is INVALID.                    " );
+        RetValue = 1;
+    }
+    else
+        Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", iFrames, pPars->nWords );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ABC_FREE( Thrs[i].pSims );
+        ABC_FREE( Thrs[i].pRands );
+    }
+    Gia_SimProgFree( pProg );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
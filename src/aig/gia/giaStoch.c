@@ -29,12 +29,26 @@
 #include <unistd.h>
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define STOCH_PAR_MAX 100
+
+extern Gia_Man_t * Gia_ManDupWithMapping( Gia_Man_t * pGia );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -135,6 +149,141 @@ Gia_Man_t * Gia_StochProcessOne( Gia_Man_t * p, char * pScript, int Rand, int Ti
     return Gia_ManDup(p);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Processing in the private frame of the current thread.]
+
+  Description [Executes the script on the partition in the frame of the 
+  current thread without spawning a process or writing files. Seeds the
+  random number generators from Rand, so that the result does not depend
+  on the partitions processed by this thread before. Returns the result
+  if it has fewer AND nodes than the partition, or a copy of the partition
+  otherwise. Returns NULL if the script has failed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_StochProcessPrivate( Gia_Man_t * p, char * pScript, int Rand )
+{
+    Gia_Man_t * pNew;
+    int i;
+    Abc_FrameUpdateGia( Abc_FrameGetGlobalFrame(), Gia_ManDupWithMapping(p) );
+    Gia_ManRandom( 1 );
+    Abc_Random( 1 );
+    for ( i = 0; i < (Rand & 0x3FF); i++ )
+        Gia_ManRandom( 0 ), Abc_Random( 0 );
+    if ( Cmd_CommandExecute(Abc_FrameGetGlobalFrame(), pScript) )
+    {
+        Abc_Print( 1, "Something did not work out with the command \"%s\".\n", pScript );
+        return NULL;
+    }
+    pNew = Abc_FrameReadGia( Abc_FrameGetGlobalFrame() );
+    if ( Gia_ManAndNum(pNew) < Gia_ManAndNum(p) )
+        return Gia_ManDupWithMapping( pNew );
+    return Gia_ManDupWithMapping( p );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+// the partitions shared by the threads
+typedef struct StochSynBatch_t_
+{
+    Vec_Ptr_t *      vGias;      // the partitions
+    Gia_Man_t **     pOuts;      // the results
+    char *           pScript;    // the script to run
+    Vec_Int_t *      vRands;     // the random seeds of the partitions
+    abctime          TimeStop;   // the deadline for starting a partition (or 0)
+    int              iNext;      // the next partition to process
+    pthread_mutex_t  Mutex;      // protects iNext
+} StochSynBatch_t;
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the partitions from the batch one at a time.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_StochWorkerThread( void * pArg )
+{
+    StochSynBatch_t * p = (StochSynBatch_t *)pArg;
+    int i;
+    Abc_FrameStartPrivate();
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        i = p->iNext < Vec_PtrSize(p->vGias) ? p->iNext++ : -1;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( i == -1 )
+            break;
+        if ( p->TimeStop && Abc_Clock() > p->TimeStop )
+            p->pOuts[i] = Gia_ManDupWithMapping( (Gia_Man_t *)Vec_PtrEntry(p->vGias, i) );
+        else
+            p->pOuts[i] = Gia_StochProcessPrivate( (Gia_Man_t *)Vec_PtrEntry(p->vGias, i), p->pScript, Vec_IntEntry(p->vRands, i) );
+    }
+    Abc_FrameStopPrivate();
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processing on many cores using private frames.]
+
+  Description [Each thread starts a private frame sharing the commands
+  and libraries with the main frame, and runs the script on the partitions 
+  taken one at a time. The script should consist of reentrant commands.
+  The partitions not started within TimeSecs seconds are left unchanged.
+  Otherwise, the result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_StochProcessThreads( Vec_Ptr_t * vGias, char * pScript, int nProcs, int TimeSecs, int fVerbose )
+{
+    pthread_t WorkerThread[STOCH_PAR_MAX];
+    StochSynBatch_t Batch, * p = &Batch;
+    Gia_Man_t * pGia;
+    int i, status, nThreads = Abc_MaxInt( 1, Abc_MinInt( nProcs, Abc_MinInt(Vec_PtrSize(vGias), STOCH_PAR_MAX) ) );
+    if ( fVerbose )
+        printf( "Running concurrent synthesis with %d threads.\n", nThreads ), fflush(stdout);
+    memset( p, 0, sizeof(StochSynBatch_t) );
+    p->vGias   = vGias;
+    p->pOuts   = ABC_CALLOC( Gia_Man_t *, Vec_PtrSize(vGias) );
+    p->pScript = pScript;
+    p->vRands  = Vec_IntAlloc( Vec_PtrSize(vGias) );
+    p->TimeStop = TimeSecs ? Abc_Clock() + (abctime)TimeSecs * CLOCKS_PER_SEC : 0;
+    Abc_Random(1);
+    for ( i = 0; i < Vec_PtrSize(vGias); i++ )
+        Vec_IntPush( p->vRands, Abc_Random(0) % 0x1000000 );
+    pthread_mutex_init( &p->Mutex, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Gia_StochWorkerThread, (void *)p );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    // replace old AIGs by new AIGs
+    Vec_PtrForEachEntry( Gia_Man_t *, vGias, pGia, i ) {
+        Gia_ManStop( pGia );
+        Vec_PtrWriteEntry( vGias, i, p->pOuts[i] );
+    }
+    Vec_IntFree( p->vRands );
+    ABC_FREE( p->pOuts );
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Generic concurrent processing.]
@@ -165,7 +314,7 @@ int Gia_StochProcess1( void * p )
     return 1;
 }
 
-void Gia_StochProcess( Vec_Ptr_t * vGias, char * pScript, int nProcs, int TimeSecs, int fVerbose )
+void Gia_StochProcess( Vec_Ptr_t * vGias, char * pScript, int nProcs, int TimeSecs, int fThreads, int fVerbose )
 {
     if ( nProcs <= 2 ) {
         if ( fVerbose )
@@ -173,6 +322,16 @@ void Gia_StochProcess( Vec_Ptr_t * vGias, char * pScript, int nProcs, int TimeSe
         Gia_StochProcessArray( vGias, pScript, TimeSecs, fVerbose );
         return;
     }
+#ifdef ABC_USE_PTHREADS
+    if ( fThreads ) {
+        Gia_StochProcessThreads( vGias, pScript, nProcs, TimeSecs, fVerbose );
+        return;
+    }
+#else
+    if ( fThreads )
+        printf( "Threads are not available in this build. Running concurrent synthesis with processes.\n" );
+#endif
+    {
     StochSynData_t * pData = ABC_CALLOC( StochSynData_t, Vec_PtrSize(vGias) );
     Vec_Ptr_t * vData = Vec_PtrAlloc( Vec_PtrSize(vGias) ); 
     Gia_Man_t * pGia; int i;
@@ -195,6 +354,7 @@ void Gia_StochProcess( Vec_Ptr_t * vGias, char * pScript, int nProcs, int TimeSe
     }
     Vec_PtrFree( vData );
     ABC_FREE( pData );
+    }
 }
 
 /**Function*************************************************************
@@ -349,7 +509,7 @@ Gia_Man_t * Gia_ManDupDivideOne( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vA
     pNew->vMapping = vMapping;
     return pNew;
 }
-Vec_Ptr_t * Gia_ManDupDivide( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, char * pScript, int nProcs, int TimeOut )
+Vec_Ptr_t * Gia_ManDupDivide( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, char * pScript, int nProcs, int TimeOut, int fThreads )
 {
     Vec_Ptr_t * vAigs = Vec_PtrAlloc( Vec_WecSize(vCis) );  int i;
     for ( i = 0; i < Vec_WecSize(vCis); i++ )
@@ -358,7 +518,7 @@ Vec_Ptr_t * Gia_ManDupDivide( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds
         Vec_PtrPush( vAigs, Gia_ManDupDivideOne(p, Vec_WecEntry(vCis, i), Vec_WecEntry(vAnds, i), Vec_WecEntry(vCos, i)) );
     }
     //Gia_ManStochSynthesis( vAigs, pScript );
-    Gia_StochProcess( vAigs, pScript, nProcs, TimeOut, 0 );
+    Gia_StochProcess( vAigs, pScript, nProcs, TimeOut, fThreads, 0 );
     return vAigs;
 }
 Gia_Man_t * Gia_ManDupStitch( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, Vec_Ptr_t * vAigs, int fHash )
@@ -554,7 +714,7 @@ Vec_Wec_t * Gia_ManStochOutputs( Gia_Man_t * p, Vec_Wec_t * vAnds )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManStochSyn( int nMaxSize, int nIters, int TimeOut, int Seed, int fVerbose, char * pScript, int nProcs )
+void Gia_ManStochSyn( int nMaxSize, int nIters, int TimeOut, int Seed, int fVerbose, char * pScript, int nProcs, int fThreads )
 {
     abctime nTimeToStop  = TimeOut ? Abc_Clock() + TimeOut * CLOCKS_PER_SEC : 0;
     abctime clkStart     = Abc_Clock();
@@ -573,7 +733,7 @@ void Gia_ManStochSyn( int nMaxSize, int nIters, int TimeOut, int Seed, int fVerb
         Vec_Wec_t * vAnds = Gia_ManStochNodes( pGia, nMaxSize, Abc_Random(0) & 0x7FFFFFFF );
         Vec_Wec_t * vIns  = Gia_ManStochInputs( pGia, vAnds );
         Vec_Wec_t * vOuts = Gia_ManStochOutputs( pGia, vAnds );
-        Vec_Ptr_t * vAigs = Gia_ManDupDivide( pGia, vIns, vAnds, vOuts, pScript, nProcs, TimeOut );
+        Vec_Ptr_t * vAigs = Gia_ManDupDivide( pGia, vIns, vAnds, vOuts, pScript, nProcs, TimeOut, fThreads );
         Gia_Man_t * pNew  = Gia_ManDupStitchMap( pGia, vIns, vAnds, vOuts, vAigs );
         int fMapped = Gia_ManHasMapping(pGia) && Gia_ManHasMapping(pNew);
         Abc_FrameUpdateGia( Abc_FrameGetGlobalFrame(), pNew );
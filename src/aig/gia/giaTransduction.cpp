@@ -29,6 +29,18 @@
 #include "giaTransduction.h"
 #include "giaNewBdd.h"
 #include "giaNewTt.h"
+#include "proof/cec/cec.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -144,6 +156,179 @@ Gia_Man_t *Gia_ManTransductionTt(Gia_Man_t *pGia, int nType, int fMspf, int nRan
   return t.GenerateAig();
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Transduction applied to windows of a large AIG.]
+
+  Description [The AIG is divided into windows of about nWinSize AND
+  nodes (groups of output cones, as in &stochsyn). Each window is
+  optimized by its own transduction instance (with its own BDD or truth
+  table manager), using up to nThreads threads. A window is replaced if
+  its result is smaller and passes the equivalence check against the
+  original window. Random parameters and PI shuffles are derived for
+  each window in the calling thread, so that the result does not depend
+  on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_TRAN_PAR_MAX 64
+#define GIA_TRAN_TT_MAX  16 // the largest window input count with truth tables
+
+struct Gia_TranWin_t {
+  Gia_Man_t *pWin;
+  Gia_Man_t *pRes;
+  int nSortType;
+  int nPiShuffle;
+  int nParameter;
+};
+
+struct Gia_TranPar_t {
+  std::vector<Gia_TranWin_t> *pWins;
+  int nType;
+  int fMspf;
+  int fLevel;
+  int fTruth;
+  int iNext;
+#ifdef ABC_USE_PTHREADS
+  pthread_mutex_t Mutex;
+#endif
+};
+
+static void Gia_ManTransductionWinOne(Gia_TranPar_t *p, Gia_TranWin_t *pWin) {
+  if(p->fTruth && Gia_ManCiNum(pWin->pWin) > GIA_TRAN_TT_MAX)
+    return;
+  if(p->fTruth)
+    pWin->pRes = Gia_ManTransductionTt(pWin->pWin, p->nType, p->fMspf, 0, pWin->nSortType, 0, pWin->nParameter, p->fLevel, NULL, 0, 0);
+  else
+    pWin->pRes = Gia_ManTransductionBdd(pWin->pWin, p->nType, p->fMspf, 0, pWin->nSortType, 0, pWin->nParameter, p->fLevel, NULL, 0, 0);
+}
+
+#ifdef ABC_USE_PTHREADS
+static void *Gia_ManTransductionWinThread(void *pArg) {
+  Gia_TranPar_t *p = (Gia_TranPar_t *)pArg;
+  while(1) {
+    int iWin;
+    pthread_mutex_lock(&p->Mutex);
+    iWin = p->iNext++;
+    pthread_mutex_unlock(&p->Mutex);
+    if(iWin >= (int)p->pWins->size())
+      break;
+    Gia_ManTransductionWinOne(p, &(*p->pWins)[iWin]);
+  }
+  return NULL;
+}
+#endif
+
+Gia_Man_t *Gia_ManTransductionWin(Gia_Man_t *pGia, int nType, int fMspf, int nRandom, int nSortType, int nPiShuffle, int nParameter, int fLevel, int fTruth, int nWinSize, int nThreads, int fNewLine, int nVerbose) {
+  abctime clk = Abc_Clock();
+  Gia_Man_t *p, *pNew;
+  Vec_Wec_t *vAnds, *vIns, *vOuts;
+  Vec_Ptr_t *vAigs;
+  std::vector<Gia_TranWin_t> vWins;
+  Gia_TranPar_t Par;
+  int i, nImproved = 0, nFailed = 0, nSkipped = 0;
+  // partition the AIG without mapping into windows
+  p = Gia_ManDup(pGia);
+  vAnds = Gia_ManStochNodes(p, nWinSize, nRandom);
+  vIns  = Gia_ManStochInputs(p, vAnds);
+  vOuts = Gia_ManStochOutputs(p, vAnds);
+  vWins.resize(Vec_WecSize(vAnds));
+  // derive the parameters of the windows (the same way as for the whole AIG)
+  if(nRandom)
+    srand(nRandom);
+  for(i = 0; i < (int)vWins.size(); i++) {
+    vWins[i].pRes = NULL;
+    vWins[i].nSortType = nRandom? rand() % 4: nSortType;
+    vWins[i].nPiShuffle = nRandom? rand(): nPiShuffle;
+    vWins[i].nParameter = nRandom? rand() % 16: nParameter;
+  }
+  // shuffle the window inputs here because the transduction uses srand()/rand()
+  for(i = 0; i < (int)vWins.size(); i++) {
+    Vec_Int_t *vIn = Vec_WecEntry(vIns, i);
+    if(vWins[i].nPiShuffle) {
+      srand(vWins[i].nPiShuffle);
+      for(int k = Vec_IntSize(vIn) - 1; k > 0; k--) {
+        int j = rand() % (k + 1);
+        int Temp = Vec_IntEntry(vIn, k);
+        Vec_IntWriteEntry(vIn, k, Vec_IntEntry(vIn, j));
+        Vec_IntWriteEntry(vIn, j, Temp);
+      }
+    }
+    vWins[i].pWin = Gia_ManDupDivideOne(p, vIn, Vec_WecEntry(vAnds, i), Vec_WecEntry(vOuts, i));
+  }
+  // optimize the windows
+  Par.pWins = &vWins;
+  Par.nType = nType;
+  Par.fMspf = fMspf;
+  Par.fLevel = fLevel;
+  Par.fTruth = fTruth;
+  Par.iNext = 0;
+  nThreads = std::min(std::max(nThreads, 1), GIA_TRAN_PAR_MAX);
+  nThreads = std::min(nThreads, (int)vWins.size());
+#ifdef ABC_USE_PTHREADS
+  if(nThreads > 1) {
+    pthread_t WorkerThread[GIA_TRAN_PAR_MAX];
+    int status;
+    pthread_mutex_init(&Par.Mutex, NULL);
+    for(i = 0; i < nThreads; i++) {
+      status = pthread_create(WorkerThread + i, NULL, Gia_ManTransductionWinThread, (void *)&Par);
+      assert(status == 0);
+    }
+    for(i = 0; i < nThreads; i++) {
+      status = pthread_join(WorkerThread[i], NULL);
+      assert(status == 0);
+    }
+    pthread_mutex_destroy(&Par.Mutex);
+  } else
+#endif
+  for(i = 0; i < (int)vWins.size(); i++)
+    Gia_ManTransductionWinOne(&Par, &vWins[i]);
+  // keep the smaller windows that are proved equivalent
+  vAigs = Vec_PtrAlloc(vWins.size());
+  for(i = 0; i < (int)vWins.size(); i++) {
+    Gia_TranWin_t *pWin = &vWins[i];
+    if(pWin->pRes == NULL)
+      nSkipped++;
+    else if(Gia_ManAndNum(pWin->pRes) < Gia_ManAndNum(pWin->pWin) && Gia_ManCiNum(pWin->pRes) == Gia_ManCiNum(pWin->pWin) && Gia_ManCoNum(pWin->pRes) == Gia_ManCoNum(pWin->pWin)) {
+      Cec_ParCec_t ParsCec, *pPars = &ParsCec;
+      Gia_Man_t *pMiter = Gia_ManMiter(pWin->pWin, pWin->pRes, 0, 1, 0, 0, 0);
+      Cec_ManCecSetDefaultParams(pPars);
+      pPars->fSilent = 1;
+      if(pMiter && Cec_ManVerify(pMiter, pPars) == 1) {
+        std::swap(pWin->pWin, pWin->pRes);
+        nImproved++;
+      } else
+        nFailed++;
+      if(pMiter)
+        Gia_ManStop(pMiter);
+    }
+    if(pWin->pRes)
+      Gia_ManStop(pWin->pRes);
+    Vec_PtrPush(vAigs, pWin->pWin);
+  }
+  pNew = Gia_ManDupStitch(p, vIns, vAnds, vOuts, vAigs, 1);
+  if(nVerbose) {
+    printf("Windows = %d (%d improved", (int)vWins.size(), nImproved);
+    if(nFailed)
+      printf(", %d failed the check", nFailed);
+    if(nSkipped)
+      printf(", %d with more than %d inputs skipped", nSkipped, GIA_TRAN_TT_MAX);
+    printf(").  ANDs = %d -> %d.  ", Gia_ManAndNum(pGia), Gia_ManAndNum(pNew));
+    Abc_PrintTime(1, "Time", Abc_Clock() - clk);
+    if(fNewLine)
+      fflush(stdout);
+  }
+  Vec_PtrFreeFunc(vAigs, (void (*)(void *)) Gia_ManStop);
+  Vec_WecFree(vAnds);
+  Vec_WecFree(vIns);
+  Vec_WecFree(vOuts);
+  Gia_ManStop(p);
+  return pNew;
+}
+
 ABC_NAMESPACE_IMPL_END
 
 #else
@@ -160,6 +345,10 @@ Gia_Man_t * Gia_ManTransductionTt(Gia_Man_t *pGia, int nType, int fMspf, int nRa
 {
     return NULL;
 }
+Gia_Man_t * Gia_ManTransductionWin(Gia_Man_t *pGia, int nType, int fMspf, int nRandom, int nSortType, int nPiShuffle, int nParameter, int fLevel, int fTruth, int nWinSize, int nThreads, int fNewLine, int nVerbose)
+{
+    return NULL;
+}
 
 ABC_NAMESPACE_IMPL_END
 
@@ -0,0 +1,364 @@
+/**CFile****************************************************************
+
+  FileName    [giaTsim2.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Bit-parallel ternary simulation.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Each object has two rails of nWords machine words each. A pattern is
+// represented by one bit in each rail: the first rail tells whether the
+// value can be 0, the second rail tells whether the value can be 1.
+// Thus, 0 is (1,0), 1 is (0,1), and X is (1,1). Combination (0,0) is not used.
+// Complementation swaps the rails; AND is the OR of the 0-rails
+// and the AND of the 1-rails.
+
+struct Gia_Tsm_t_
+{
+    Gia_Man_t *    pGia;         // user's AIG
+    int            nWords;       // the number of words in one rail
+    int            fFanouts;     // set to 1 if static fanout was started here
+    Vec_Wrd_t *    vSims;        // dual-rail simulation info (2*nWords per object)
+    Vec_Bit_t *    vChanged;     // objects whose values changed (incremental mode)
+    Vec_Int_t *    vTfo;         // transitive fanout (incremental mode)
+    Vec_Int_t *    vRoots;       // temporary storage
+    word *         pTemp;        // temporary rail storage
+};
+
+static inline word * Gia_TsmSim0( Gia_Tsm_t * p, int iObj ) { return Vec_WrdEntryP( p->vSims, 2 * p->nWords * iObj );               }
+static inline word * Gia_TsmSim1( Gia_Tsm_t * p, int iObj ) { return Vec_WrdEntryP( p->vSims, 2 * p->nWords * iObj + p->nWords );  }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the bit-parallel ternary simulator.]
+
+  Description [The number of words (nWords) determines how many
+  independent ternary patterns (64*nWords) are simulated at the same time.
+  Initially, all CIs are set to X and the constant node to 0, and the
+  simulation info of all objects is up-to-date.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Tsm_t * Gia_TsmStart( Gia_Man_t * pGia, int nWords )
+{
+    Gia_Tsm_t * p;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( nWords > 0 );
+    p = ABC_CALLOC( Gia_Tsm_t, 1 );
+    p->pGia     = pGia;
+    p->nWords   = nWords;
+    p->vSims    = Vec_WrdStart( 2 * nWords * Gia_ManObjNum(pGia) );
+    p->vChanged = Vec_BitStart( Gia_ManObjNum(pGia) );
+    p->vTfo     = Vec_IntAlloc( 100 );
+    p->vRoots   = Vec_IntAlloc( 100 );
+    p->pTemp    = ABC_ALLOC( word, 2 * nWords );
+    Abc_TtFill( Gia_TsmSim0(p, 0), nWords );
+    Gia_ManForEachCi( pGia, pObj, i )
+        Gia_TsmSetCi( p, Gia_ObjId(pGia, pObj), GIA_UND );
+    Gia_TsmSimulate( p, NULL );
+    return p;
+}
+void Gia_TsmStop( Gia_Tsm_t * p )
+{
+    if ( p->fFanouts )
+        Gia_ManStaticFanoutStop( p->pGia );
+    Vec_WrdFree( p->vSims );
+    Vec_BitFree( p->vChanged );
+    Vec_IntFree( p->vTfo );
+    Vec_IntFree( p->vRoots );
+    ABC_FREE( p->pTemp );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads and writes ternary values.]
+
+  Description [Values are GIA_ZER, GIA_ONE, and GIA_UND.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_TsmSetCi( Gia_Tsm_t * p, int iObj, int Value )
+{
+    assert( Gia_ObjIsCi(Gia_ManObj(p->pGia, iObj)) );
+    assert( Value >= GIA_ZER && Value <= GIA_UND );
+    if ( Value & GIA_ZER )
+        Abc_TtFill( Gia_TsmSim0(p, iObj), p->nWords );
+    else
+        Abc_TtClear( Gia_TsmSim0(p, iObj), p->nWords );
+    if ( Value & GIA_ONE )
+        Abc_TtFill( Gia_TsmSim1(p, iObj), p->nWords );
+    else
+        Abc_TtClear( Gia_TsmSim1(p, iObj), p->nWords );
+}
+void Gia_TsmSetCiPat( Gia_Tsm_t * p, int iObj, int iPat, int Value )
+{
+    word * pSim0 = Gia_TsmSim0(p, iObj);
+    word * pSim1 = Gia_TsmSim1(p, iObj);
+    assert( Gia_ObjIsCi(Gia_ManObj(p->pGia, iObj)) );
+    assert( Value >= GIA_ZER && Value <= GIA_UND );
+    assert( iPat >= 0 && iPat < 64 * p->nWords );
+    if ( Abc_TtGetBit(pSim0, iPat) != ((Value & GIA_ZER) != 0) )
+        Abc_TtXorBit( pSim0, iPat );
+    if ( Abc_TtGetBit(pSim1, iPat) != ((Value & GIA_ONE) != 0) )
+        Abc_TtXorBit( pSim1, iPat );
+}
+int Gia_TsmObjValue( Gia_Tsm_t * p, int iObj, int iPat )
+{
+    int Value = (Abc_TtGetBit(Gia_TsmSim0(p, iObj), iPat) ? GIA_ZER : 0) |
+                (Abc_TtGetBit(Gia_TsmSim1(p, iObj), iPat) ? GIA_ONE : 0);
+    assert( Value != 0 );
+    return Value;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one object.]
+
+  Description [Returns 1 if the simulation info of the object has changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_TsmSimulateObj( Gia_Tsm_t * p, Gia_Obj_t * pObj, int iObj, int fCheck )
+{
+    word * pSim0 = Gia_TsmSim0( p, iObj );
+    word * pSim1 = Gia_TsmSim1( p, iObj );
+    word * p00, * p01, * p10, * p11;
+    int w, Id0 = Gia_ObjFaninId0(pObj, iObj);
+    // get the rails of the first fanin, swapped if complemented
+    p00 = Gia_ObjFaninC0(pObj) ? Gia_TsmSim1(p, Id0) : Gia_TsmSim0(p, Id0);
+    p01 = Gia_ObjFaninC0(pObj) ? Gia_TsmSim0(p, Id0) : Gia_TsmSim1(p, Id0);
+    if ( fCheck )
+        memcpy( p->pTemp, pSim0, sizeof(word) * 2 * p->nWords );
+    if ( Gia_ObjIsCo(pObj) )
+    {
+        for ( w = 0; w < p->nWords; w++ )
+            pSim0[w] = p00[w], pSim1[w] = p01[w];
+    }
+    else
+    {
+        int Id1 = Gia_ObjFaninId1(pObj, iObj);
+        assert( Gia_ObjIsAnd(pObj) );
+        p10 = Gia_ObjFaninC1(pObj) ? Gia_TsmSim1(p, Id1) : Gia_TsmSim0(p, Id1);
+        p11 = Gia_ObjFaninC1(pObj) ? Gia_TsmSim0(p, Id1) : Gia_TsmSim1(p, Id1);
+        for ( w = 0; w < p->nWords; w++ )
+            pSim0[w] = p00[w] | p10[w], pSim1[w] = p01[w] & p11[w];
+    }
+    return fCheck && memcmp( p->pTemp, pSim0, sizeof(word) * 2 * p->nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs ternary simulation of the nodes and COs.]
+
+  Description [If vObjs is NULL, simulates all internal nodes and COs.
+  Otherwise, vObjs is the set of node and CO IDs in a topological order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_TsmSimulate( Gia_Tsm_t * p, Vec_Int_t * vObjs )
+{
+    Gia_Obj_t * pObj;
+    int i, iObj;
+    if ( vObjs == NULL )
+    {
+        Gia_ManForEachObj1( p->pGia, pObj, i )
+            if ( !Gia_ObjIsCi(pObj) )
+                Gia_TsmSimulateObj( p, pObj, i, 0 );
+        return;
+    }
+    Vec_IntForEachEntry( vObjs, iObj, i )
+        Gia_TsmSimulateObj( p, Gia_ManObj(p->pGia, iObj), iObj, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Incrementally re-simulates the TFO of the changed CIs.]
+
+  Description [Assumes that the simulation info was up-to-date before
+  the values of the CIs in vCis were modified. Only the transitive fanout
+  of these CIs is visited, and a node is re-evaluated only if one of its
+  fanins has changed. Returns the number of re-evaluated objects.]
+
+  SideEffects [Starts static fanout of the AIG if it is not available.]
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_TsmSimulateTfo( Gia_Tsm_t * p, Vec_Int_t * vCis )
+{
+    Gia_Obj_t * pObj;
+    int i, k, iObj, iFan, nEvals = 0;
+    if ( p->pGia->vFanoutNums == NULL )
+    {
+        Gia_ManStaticFanoutStart( p->pGia );
+        p->fFanouts = 1;
+    }
+    // collect the TFO using the fanout arrays
+    Gia_ManIncrementTravId( p->pGia );
+    Vec_IntClear( p->vTfo );
+    Vec_IntForEachEntry( vCis, iObj, i )
+    {
+        assert( Gia_ObjIsCi(Gia_ManObj(p->pGia, iObj)) );
+        Gia_ObjSetTravIdCurrentId( p->pGia, iObj );
+        Vec_BitWriteEntry( p->vChanged, iObj, 1 );
+    }
+    Vec_IntForEachEntry( vCis, iObj, i )
+        Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFan, k )
+            if ( !Gia_ObjUpdateTravIdCurrentId(p->pGia, iFan) )
+                Vec_IntPush( p->vTfo, iFan );
+    for ( i = 0; i < Vec_IntSize(p->vTfo); i++ )
+    {
+        iObj = Vec_IntEntry( p->vTfo, i );
+        Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFan, k )
+            if ( !Gia_ObjUpdateTravIdCurrentId(p->pGia, iFan) )
+                Vec_IntPush( p->vTfo, iFan );
+    }
+    Vec_IntSort( p->vTfo, 0 );
+    // propagate the changes in the topological order
+    Gia_ManForEachObjVec( p->vTfo, p->pGia, pObj, i )
+    {
+        iObj = Gia_ObjId( p->pGia, pObj );
+        if ( !Vec_BitEntry(p->vChanged, Gia_ObjFaninId0(pObj, iObj)) &&
+             !(Gia_ObjIsAnd(pObj) && Vec_BitEntry(p->vChanged, Gia_ObjFaninId1(pObj, iObj))) )
+            continue;
+        nEvals++;
+        if ( Gia_TsmSimulateObj( p, pObj, iObj, 1 ) )
+            Vec_BitWriteEntry( p->vChanged, iObj, 1 );
+    }
+    // clean the change markers
+    Vec_IntForEachEntry( vCis, iObj, i )
+        Vec_BitWriteEntry( p->vChanged, iObj, 0 );
+    Vec_IntForEachEntry( p->vTfo, iObj, i )
+        Vec_BitWriteEntry( p->vChanged, iObj, 0 );
+    return nEvals;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the patterns where all objects have binary values.]
+
+  Description [Returns the number of such patterns among 64*nWords.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_TsmBinaryMask( Gia_Tsm_t * p, Vec_Int_t * vObjs, word * pMask )
+{
+    int i, w, iObj;
+    Abc_TtFill( pMask, p->nWords );
+    Vec_IntForEachEntry( vObjs, iObj, i )
+    {
+        word * pSim0 = Gia_TsmSim0( p, iObj );
+        word * pSim1 = Gia_TsmSim1( p, iObj );
+        for ( w = 0; w < p->nWords; w++ )
+            pMask[w] &= ~(pSim0[w] & pSim1[w]);
+    }
+    return Abc_TtCountOnesVec( pMask, p->nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tests many CI value drops at the same time.]
+
+  Description [Assumes that CIs in vCiObjs have binary values vCiVals
+  (0/1 values given as integers) and that, under these values, all
+  objects in vCoObjs have binary values. For each CI in vCands,
+  checks whether it can be made X individually without making any
+  object in vCoObjs undefined. Every candidate gets a pattern of
+  its own, so up to 64*nWords candidates are tested in one incremental
+  simulation pass. The i-th entry of vDrops is set to 1 if the i-th
+  candidate can be dropped. Because ternary simulation is monotone,
+  a candidate rejected here cannot be dropped together with other CIs.
+  Returns the number of candidates that can be dropped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_TsmFindDrops( Gia_Tsm_t * p, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vCoObjs, Vec_Int_t * vCands, Vec_Int_t * vDrops )
+{
+    int nPats = 64 * p->nWords;
+    int i, k, iObj, Value, nDrops = 0;
+    word * pMask = ABC_ALLOC( word, p->nWords );
+    assert( Vec_IntSize(vCiObjs) == Vec_IntSize(vCiVals) );
+    // establish the binary values in all patterns
+    Vec_IntForEachEntryTwo( vCiObjs, vCiVals, iObj, Value, i )
+        Gia_TsmSetCi( p, iObj, Value ? GIA_ONE : GIA_ZER );
+    Gia_TsmSimulateTfo( p, vCiObjs );
+    assert( Gia_TsmBinaryMask(p, vCoObjs, pMask) == nPats );
+    // test the candidates in chunks of nPats
+    Vec_IntFill( vDrops, Vec_IntSize(vCands), 0 );
+    for ( i = 0; i < Vec_IntSize(vCands); i += nPats )
+    {
+        int iStop = Abc_MinInt( i + nPats, Vec_IntSize(vCands) );
+        Vec_IntClear( p->vRoots );
+        for ( k = i; k < iStop; k++ )
+        {
+            iObj = Vec_IntEntry( vCands, k );
+            Gia_TsmSetCiPat( p, iObj, k - i, GIA_UND );
+            Vec_IntPush( p->vRoots, iObj );
+        }
+        Gia_TsmSimulateTfo( p, p->vRoots );
+        Gia_TsmBinaryMask( p, vCoObjs, pMask );
+        for ( k = i; k < iStop; k++ )
+            if ( Abc_TtGetBit(pMask, k - i) )
+                Vec_IntWriteEntry( vDrops, k, 1 ), nDrops++;
+        // restore the binary values
+        Vec_IntForEachEntryTwo( vCiObjs, vCiVals, iObj, Value, k )
+            Gia_TsmSetCi( p, iObj, Value ? GIA_ONE : GIA_ZER );
+        Gia_TsmSimulateTfo( p, p->vRoots );
+    }
+    ABC_FREE( pMask );
+    return nDrops;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
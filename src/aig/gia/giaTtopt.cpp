@@ -32,6 +32,15 @@
 #include "gia.h"
 #include "misc/vec/vecHash.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 namespace Ttopt {
@@ -77,6 +86,8 @@ public:
     }
   }
 
+  virtual ~TruthTable() {}
+
   virtual void Save(unsigned i) {
     if(savedt.size() < i + 1) {
       savedt.resize(i + 1);
@@ -393,11 +404,11 @@ public:
     assert(vLevels == vLevelsNew);
   }
 
-  int RandomSiftReo(int nRound) {
-    int best = SiftReo();
-    Save(2);
+  static void RandomLevels(int nInputs, int nRound, std::vector<std::vector<int> > &vvLevelsNew) {
+    vvLevelsNew.resize(nRound);
     for(int i = 0; i < nRound; i++) {
-      std::vector<int> vLevelsNew(nInputs);
+      std::vector<int> &vLevelsNew = vvLevelsNew[i];
+      vLevelsNew.resize(nInputs);
       int j;
       for(j = 0; j < nInputs; j++) {
         vLevelsNew[j] = j;
@@ -406,7 +417,20 @@ public:
         int d = rand() % j;
         std::swap(vLevelsNew[j], vLevelsNew[d]);
       }
-      Reo(vLevelsNew);
+    }
+  }
+
+  int RandomSiftReo(int nRound) {
+    std::vector<std::vector<int> > vvLevelsNew;
+    RandomLevels(nInputs, nRound, vvLevelsNew);
+    return RandomSiftReo(vvLevelsNew);
+  }
+
+  int RandomSiftReo(std::vector<std::vector<int> > const &vvLevelsNew) {
+    int best = SiftReo();
+    Save(2);
+    for(unsigned i = 0; i < vvLevelsNew.size(); i++) {
+      Reo(vvLevelsNew[i]);
       int r = SiftReo();
       if(best > r) {
         best = r;
@@ -1106,14 +1130,54 @@ public:
 
 }
 
-Gia_Man_t * Gia_ManTtopt( Gia_Man_t * p, int nIns, int nOuts, int nRounds )
+#define GIA_TTOPT_PAR_MAX 64
+
+struct Gia_TtoptGroup_t
+{
+    Vec_Int_t * vSupp;
+    Ttopt::TruthTableReo * pTt;
+    std::vector<std::vector<int> > vvLevels;
+};
+
+struct Gia_TtoptPar_t
+{
+    std::vector<Gia_TtoptGroup_t> * pGroups;
+    int iNext;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;
+#endif
+};
+
+#ifdef ABC_USE_PTHREADS
+static void * Gia_ManTtoptThread( void * pArg )
+{
+    Gia_TtoptPar_t * p = (Gia_TtoptPar_t *)pArg;
+    while ( 1 )
+    {
+        int iGroup;
+        pthread_mutex_lock( &p->Mutex );
+        iGroup = p->iNext++;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iGroup >= (int)p->pGroups->size() )
+            break;
+        Gia_TtoptGroup_t * pGroup = &(*p->pGroups)[iGroup];
+        pGroup->pTt->RandomSiftReo( pGroup->vvLevels );
+    }
+    return NULL;
+}
+#endif
+
+Gia_Man_t * Gia_ManTtoptPar( Gia_Man_t * p, int nIns, int nOuts, int nRounds, int nThreads )
 {
     Gia_Man_t * pNew;
     Gia_Obj_t * pObj;
-    Vec_Int_t * vSupp;
+    std::vector<Gia_TtoptGroup_t> vGroups;
+    Gia_TtoptPar_t Par;
     word v;
     word * pTruth;
-    int i, g, k, nInputs;
+    int i, g, k, b, nInputs, nBatch;
+    nThreads = Abc_MinInt( Abc_MaxInt( nThreads, 1 ), GIA_TTOPT_PAR_MAX );
+    nBatch = nThreads == 1 ? 1 : 4 * nThreads;
     Gia_ManLevelNum( p );
     pNew = Gia_ManStart( Gia_ManObjNum(p) );
     pNew->pName = Abc_UtilStrsav( p->pName );
@@ -1122,31 +1186,71 @@ Gia_Man_t * Gia_ManTtopt( Gia_Man_t * p, int nIns, int nOuts, int nRounds )
         Gia_ManAppendCi( pNew );
     Gia_ObjComputeTruthTableStart( p, nIns );
     Gia_ManHashStart( pNew );
-    for ( g = 0; g < Gia_ManCoNum(p); g += nOuts )
+    for ( b = 0; b < Gia_ManCoNum(p); b += nBatch * nOuts )
     {
-        vSupp = Gia_ManCollectSuppNew( p, g, nOuts );
-        nInputs = Vec_IntSize( vSupp );
-        Ttopt::TruthTableReo tt( nInputs, nOuts );
-        for ( k = 0; k < nOuts; k++ )
+        // derive the truth tables and the random orders of this batch of output groups
+        // (the truth table manager and rand() are not thread-safe)
+        vGroups.clear();
+        for ( g = b; g < Gia_ManCoNum(p) && g < b + nBatch * nOuts; g += nOuts )
         {
-            pObj = Gia_ManCo( p, g+k );
-            pTruth = Gia_ObjComputeTruthTableCut( p, Gia_ObjFanin0(pObj), vSupp );
-            if ( nInputs >= 6 )
-                for ( i = 0; i < tt.nSize; i++ )
-                    tt.t[i + tt.nSize * k] = Gia_ObjFaninC0(pObj)? ~pTruth[i]: pTruth[i];
-            else
+            vGroups.resize( vGroups.size() + 1 );
+            Gia_TtoptGroup_t * pGroup = &vGroups.back();
+            pGroup->vSupp = Gia_ManCollectSuppNew( p, g, nOuts );
+            nInputs = Vec_IntSize( pGroup->vSupp );
+            pGroup->pTt = new Ttopt::TruthTableReo( nInputs, nOuts );
+            Ttopt::TruthTableReo & tt = *pGroup->pTt;
+            for ( k = 0; k < nOuts; k++ )
             {
-                i = k * (1 << nInputs);
-                v = (Gia_ObjFaninC0(pObj)? ~pTruth[0]: pTruth[0]) & tt.ones[nInputs];
-                tt.t[i / tt.ww] |= v << (i % tt.ww);
+                pObj = Gia_ManCo( p, g+k );
+                pTruth = Gia_ObjComputeTruthTableCut( p, Gia_ObjFanin0(pObj), pGroup->vSupp );
+                if ( nInputs >= 6 )
+                    for ( i = 0; i < tt.nSize; i++ )
+                        tt.t[i + tt.nSize * k] = Gia_ObjFaninC0(pObj)? ~pTruth[i]: pTruth[i];
+                else
+                {
+                    i = k * (1 << nInputs);
+                    v = (Gia_ObjFaninC0(pObj)? ~pTruth[0]: pTruth[0]) & tt.ones[nInputs];
+                    tt.t[i / tt.ww] |= v << (i % tt.ww);
+                }
             }
+            Ttopt::TruthTable::RandomLevels( nInputs, nRounds, pGroup->vvLevels );
+        }
+        // search for the variable orders of the groups
+        Par.pGroups = &vGroups;
+        Par.iNext = 0;
+#ifdef ABC_USE_PTHREADS
+        if ( nThreads > 1 && vGroups.size() > 1 )
+        {
+            pthread_t WorkerThread[GIA_TTOPT_PAR_MAX];
+            int status, nWorkers = Abc_MinInt( nThreads, (int)vGroups.size() );
+            pthread_mutex_init( &Par.Mutex, NULL );
+            for ( i = 0; i < nWorkers; i++ )
+            {
+                status = pthread_create( WorkerThread + i, NULL, Gia_ManTtoptThread, (void *)&Par );
+                assert( status == 0 );
+            }
+            for ( i = 0; i < nWorkers; i++ )
+            {
+                status = pthread_join( WorkerThread[i], NULL );
+                assert( status == 0 );
+            }
+            pthread_mutex_destroy( &Par.Mutex );
+        }
+        else
+#endif
+        for ( i = 0; i < (int)vGroups.size(); i++ )
+            vGroups[i].pTt->RandomSiftReo( vGroups[i].vvLevels );
+        // generate the AIGs in the original order of the groups
+        for ( i = 0; i < (int)vGroups.size(); i++ )
+        {
+            Ttopt::TruthTableReo & tt = *vGroups[i].pTt;
+            Ttopt::TruthTable tt2( tt.nInputs, nOuts );
+            tt2.t = tt.t;
+            tt2.Reo( tt.vLevels );
+            tt2.BDDGenerateAig( pNew, vGroups[i].vSupp );
+            Vec_IntFree( vGroups[i].vSupp );
+            delete vGroups[i].pTt;
         }
-        tt.RandomSiftReo( nRounds );
-        Ttopt::TruthTable tt2( nInputs, nOuts );
-        tt2.t = tt.t;
-        tt2.Reo( tt.vLevels );
-        tt2.BDDGenerateAig( pNew, vSupp );
-        Vec_IntFree( vSupp );
     }
     Gia_ObjComputeTruthTableStop( p );
     Gia_ManHashStop( pNew );
@@ -1154,6 +1258,11 @@ Gia_Man_t * Gia_ManTtopt( Gia_Man_t * p, int nIns, int nOuts, int nRounds )
     return pNew;
 }
 
+Gia_Man_t * Gia_ManTtopt( Gia_Man_t * p, int nIns, int nOuts, int nRounds )
+{
+    return Gia_ManTtoptPar( p, nIns, nOuts, nRounds, 1 );
+}
+
 Gia_Man_t * Gia_ManTtoptCare( Gia_Man_t * p, int nIns, int nOuts, int nRounds, char * pFileName, int nRarity )
 {
     int fVerbose = 0;
@@ -63,6 +63,8 @@ struct Saig_ParBbr_t_
     int         fSilent;
     int         fSkipOutCheck;// skip output checking
     int         iFrame;       // explored up to this frame
+    int         RunId;        // BDD reachability id in this run 
+    int(*pFuncStop)(int);     // callback to terminate
 };
 
 
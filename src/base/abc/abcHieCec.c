@@ -21,6 +21,21 @@
 #include "abc.h"
 #include "base/io/ioAbc.h"
 #include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "sat/cnf/cnf.h"
+#include "sat/bsat/satSolver.h"
+#include "proof/cec/cec.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -31,6 +46,33 @@ ABC_NAMESPACE_IMPL_START
 #define Abc_ObjForEachFaninReal( pObj, pFanin, i )          \
     for ( i = 0; (i < Abc_ObjFaninNum(pObj)) && (((pFanin) = Abc_ObjFaninReal(pObj, i)), 1); i++ )
 
+#define HIE_CEC_PAR_MAX 64
+
+// a pair of matching modules of the two designs
+typedef struct Hie_CecPair_t_ Hie_CecPair_t;
+struct Hie_CecPair_t_
+{
+    Abc_Ntk_t *     pNtks[2];     // the modules
+    Gia_Man_t *     pGias[2];     // the module logic with box boundaries as cut points
+    word            Hashes[2];    // the structural hashes of the module logic
+    Gia_Man_t *     pMiter;       // the single-output miter
+    int             Status;       // 1 = proved; 0 = disproved; -1 = undecided
+    int             fCached;      // the pair was proved before
+    abctime         Time;         // the runtime of the proof
+};
+
+// the state shared by the threads proving the pairs
+typedef struct Hie_CecMan_t_ Hie_CecMan_t;
+struct Hie_CecMan_t_
+{
+    Vec_Ptr_t *     vPairs;       // the pairs to be proved
+    int             iNext;        // the next pair to be proved
+    int             TimeLimit;    // the runtime limit for one pair (in seconds)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;        // protects iNext and the CNF manager
+#endif
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -755,6 +797,665 @@ Gia_Man_t * Abc_NtkHieCecTest( char * pFileName, int fVerbose )
     return pGia;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Compares two boxes by their model and output net names.]
+
+  Description [BLIF does not name the instances, so a box is identified
+  by the name of its model and the name of the net driven by its first
+  output.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Abc_NtkHieCecBoxName( Abc_Obj_t * pBox )
+{
+    return Abc_ObjName( Abc_ObjFanout0(Abc_ObjFanout0(pBox)) );
+}
+static int Abc_NtkHieCecCompareBoxes( Abc_Obj_t ** pp1, Abc_Obj_t ** pp2 )
+{
+    int Diff = strcmp( Abc_NtkName((Abc_Ntk_t *)(*pp1)->pData), Abc_NtkName((Abc_Ntk_t *)(*pp2)->pData) );
+    if ( Diff )
+        return Diff;
+    return strcmp( Abc_NtkHieCecBoxName(*pp1), Abc_NtkHieCecBoxName(*pp2) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the boxes of the module in a canonical order.]
+
+  Description [Assumes that the DFS order of nodes and boxes is stored
+  in pNtk->pData.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Abc_NtkHieCecBoxes( Abc_Ntk_t * pNtk )
+{
+    Vec_Ptr_t * vOrder = (Vec_Ptr_t *)pNtk->pData;
+    Vec_Ptr_t * vBoxes = Vec_PtrAlloc( 100 );
+    Abc_Obj_t * pObj;
+    int i;
+    Vec_PtrForEachEntry( Abc_Obj_t *, vOrder, pObj, i )
+        if ( Abc_ObjIsBox(pObj) && Abc_ObjFanoutNum(pObj) > 0 )
+            Vec_PtrPush( vBoxes, pObj );
+    Vec_PtrSort( vBoxes, (int (*)(const void *, const void *))Abc_NtkHieCecCompareBoxes );
+    return vBoxes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks that the two modules have the same signature.]
+
+  Description [The modules match if they have the same name (unless they
+  are the top modules), the same ordered lists of input and output names,
+  and the same boxes. Returns 1 if the modules match.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkHieCecMatch( Abc_Ntk_t * p0, Abc_Ntk_t * p1, Vec_Ptr_t * vBoxes0, Vec_Ptr_t * vBoxes1, int fTop )
+{
+    Abc_Obj_t * pObj0, * pObj1;
+    int i;
+    if ( !fTop && strcmp(Abc_NtkName(p0), Abc_NtkName(p1)) )
+        return 0;
+    if ( Abc_NtkHasBlackbox(p0) != Abc_NtkHasBlackbox(p1) )
+        return 0;
+    if ( Abc_NtkPiNum(p0) != Abc_NtkPiNum(p1) || Abc_NtkPoNum(p0) != Abc_NtkPoNum(p1) )
+        return 0;
+    Abc_NtkForEachPi( p0, pObj0, i )
+        if ( strcmp(Abc_ObjName(Abc_ObjFanout0(pObj0)), Abc_ObjName(Abc_ObjFanout0(Abc_NtkPi(p1, i)))) )
+            return 0;
+    Abc_NtkForEachPo( p0, pObj0, i )
+        if ( strcmp(Abc_ObjName(Abc_ObjFanin0(pObj0)), Abc_ObjName(Abc_ObjFanin0(Abc_NtkPo(p1, i)))) )
+            return 0;
+    if ( vBoxes0 == NULL )
+        return 1;
+    if ( Vec_PtrSize(vBoxes0) != Vec_PtrSize(vBoxes1) )
+        return 0;
+    Vec_PtrForEachEntryTwo( Abc_Obj_t *, vBoxes0, Abc_Obj_t *, vBoxes1, pObj0, pObj1, i )
+        if ( Abc_NtkHieCecCompareBoxes(&pObj0, &pObj1) )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the logic of one module with boxes as cut points.]
+
+  Description [The combinational inputs are the module inputs followed by
+  the box outputs. The combinational outputs are the module outputs
+  followed by the box inputs. The boxes are taken in the given order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Abc_NtkHieCecDeriveModule( Abc_Ntk_t * pNtk, Vec_Ptr_t * vBoxes )
+{
+    int gFanins[16];
+    Vec_Ptr_t * vOrder = (Vec_Ptr_t *)pNtk->pData;
+    Gia_Man_t * pTemp, * pGia;
+    Abc_Obj_t * pObj, * pTerm;
+    int i, k;
+    assert( Abc_NtkIsNetlist(pNtk) );
+    Abc_NtkFillTemp( pNtk );
+    pGia = Gia_ManStart( 1000 );
+    pGia->pName = Abc_UtilStrsav( Abc_NtkName(pNtk) );
+    Gia_ManHashAlloc( pGia );
+    Abc_NtkForEachPi( pNtk, pTerm, i )
+        Abc_ObjFanout0(pTerm)->iTemp = Gia_ManAppendCi( pGia );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vBoxes, pObj, i )
+        Abc_ObjForEachFanout( pObj, pTerm, k )
+            Abc_ObjFanout0(pTerm)->iTemp = Gia_ManAppendCi( pGia );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vOrder, pObj, i )
+    {
+        char * pSop = (char *)pObj->pData;
+        if ( !Abc_ObjIsNode(pObj) )
+            continue;
+        assert( Abc_ObjFaninNum(pObj) <= 16 );
+        assert( Abc_ObjFaninNum(pObj) == Abc_SopGetVarNum(pSop) );
+        Abc_ObjForEachFanin( pObj, pTerm, k )
+        {
+            gFanins[k] = pTerm->iTemp;
+            assert( gFanins[k] >= 0 );
+        }
+        Abc_ObjFanout0(pObj)->iTemp = Abc_NtkDeriveFlatGiaSop( pGia, gFanins, pSop );
+    }
+    Abc_NtkForEachPo( pNtk, pTerm, i )
+    {
+        assert( Abc_ObjFanin0(pTerm)->iTemp >= 0 );
+        Gia_ManAppendCo( pGia, Abc_ObjFanin0(pTerm)->iTemp );
+    }
+    Vec_PtrForEachEntry( Abc_Obj_t *, vBoxes, pObj, i )
+        Abc_ObjForEachFanin( pObj, pTerm, k )
+        {
+            assert( Abc_ObjFanin0(pTerm)->iTemp >= 0 );
+            Gia_ManAppendCo( pGia, Abc_ObjFanin0(pTerm)->iTemp );
+        }
+    Gia_ManHashStop( pGia );
+    Gia_ManSetRegNum( pGia, 0 );
+    pGia = Gia_ManCleanup( pTemp = pGia );
+    Gia_ManStop( pTemp );
+    return pGia;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the structural hash of the module logic.]
+
+  Description [Hashes the AIGER image of the AIG, which does not depend
+  on the names, using 64-bit FNV-1a.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Abc_NtkHieCecHash( Gia_Man_t * p )
+{
+    Vec_Str_t * vStr = Gia_AigerWriteIntoMemoryStr( p );
+    word Hash = ABC_CONST(0xCBF29CE484222325);
+    int i;
+    for ( i = 0; i < Vec_StrSize(vStr); i++ )
+        Hash = (Hash ^ (word)(unsigned char)Vec_StrEntry(vStr, i)) * ABC_CONST(0x100000001B3);
+    Vec_StrFree( vStr );
+    return Hash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the single-output miter of two modules.]
+
+  Description [The output is the OR of the XORs of the matching outputs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Abc_NtkHieCecMiter( Gia_Man_t * p0, Gia_Man_t * p1 )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Gia_Obj_t * pObj;
+    int i, iLit = 0;
+    assert( Gia_ManCiNum(p0) == Gia_ManCiNum(p1) );
+    assert( Gia_ManCoNum(p0) == Gia_ManCoNum(p1) );
+    pNew = Gia_ManStart( Gia_ManObjNum(p0) + Gia_ManObjNum(p1) );
+    pNew->pName = Abc_UtilStrsav( p0->pName );
+    Gia_ManHashAlloc( pNew );
+    Gia_ManConst0(p0)->Value = Gia_ManConst0(p1)->Value = 0;
+    Gia_ManForEachCi( p0, pObj, i )
+        pObj->Value = Gia_ManCi(p1, i)->Value = Gia_ManAppendCi( pNew );
+    Gia_ManForEachAnd( p0, pObj, i )
+        pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachAnd( p1, pObj, i )
+        pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachCo( p0, pObj, i )
+        iLit = Gia_ManHashOr( pNew, iLit, Gia_ManHashXor(pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin0Copy(Gia_ManCo(p1, i))) );
+    Gia_ManAppendCo( pNew, iLit );
+    Gia_ManHashStop( pNew );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves one pair of modules.]
+
+  Description [The CNF is derived under the mutex because the CNF manager
+  is shared.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkHieCecProvePair( Hie_CecMan_t * p, Hie_CecPair_t * pPair )
+{
+    abctime clk = Abc_Clock();
+    Gia_Obj_t * pPo = Gia_ManPo( pPair->pMiter, 0 );
+    Aig_Man_t * pAig;
+    Cnf_Dat_t * pCnf;
+    sat_solver * pSat;
+    int i, status;
+    if ( Gia_ObjFaninLit0p(pPair->pMiter, pPo) == 0 )
+    {
+        pPair->Status = 1;
+        pPair->Time = Abc_Clock() - clk;
+        return;
+    }
+    if ( Gia_ObjFaninLit0p(pPair->pMiter, pPo) == 1 )
+    {
+        pPair->Status = 0;
+        pPair->Time = Abc_Clock() - clk;
+        return;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    pAig = Gia_ManToAigSimple( pPair->pMiter );
+    pAig->nRegs = 0;
+    pCnf = Cnf_Derive( pAig, 0 );
+    Aig_ManStop( pAig );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    pSat = sat_solver_new();
+    sat_solver_setnvars( pSat, pCnf->nVars );
+    status = l_True;
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        if ( !sat_solver_addclause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1] ) )
+        {
+            status = l_False;
+            break;
+        }
+    if ( status == l_True )
+    {
+        sat_solver_set_runtime_limit( pSat, p->TimeLimit ? p->TimeLimit * CLOCKS_PER_SEC + Abc_Clock() : 0 );
+        status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    }
+    sat_solver_delete( pSat );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    Cnf_DataFree( pCnf );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    pPair->Status = status == l_False ? 1 : (status == l_True ? 0 : -1);
+    pPair->Time = Abc_Clock() - clk;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the pairs one at a time.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Abc_NtkHieCecThread( void * pArg )
+{
+    Hie_CecMan_t * p = (Hie_CecMan_t *)pArg;
+    int iPair;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        iPair = p->iNext < Vec_PtrSize(p->vPairs) ? p->iNext++ : -1;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iPair == -1 )
+            break;
+        Abc_NtkHieCecProvePair( p, (Hie_CecPair_t *)Vec_PtrEntry(p->vPairs, iPair) );
+    }
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Proves the pairs of modules using several threads.]
+
+  Description [The pairs are independent, so each thread takes the next
+  pair as soon as it is done with the previous one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkHieCecProvePairs( Vec_Ptr_t * vPairs, int nThreads, int TimeLimit )
+{
+    Hie_CecMan_t Man, * p = &Man;
+    int i;
+    memset( p, 0, sizeof(Hie_CecMan_t) );
+    p->vPairs    = vPairs;
+    p->TimeLimit = TimeLimit;
+    nThreads = Abc_MaxInt( 1, Abc_MinInt( nThreads, Abc_MinInt(Vec_PtrSize(vPairs), HIE_CEC_PAR_MAX) ) );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[HIE_CEC_PAR_MAX];
+        int status;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Abc_NtkHieCecThread, (void *)p );  assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+    }
+    else
+#endif
+    for ( i = 0; i < Vec_PtrSize(vPairs); i++ )
+        Abc_NtkHieCecProvePair( p, (Hie_CecPair_t *)Vec_PtrEntry(vPairs, i) );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the hashes of the proved pairs.]
+
+  Description [Each line of the cache file contains the hashes of the two
+  modules followed by the module name. Returns the array of hash pairs,
+  which is empty if the file does not exist.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t * Abc_NtkHieCecCacheRead( char * pFileName )
+{
+    Vec_Wrd_t * vCache = Vec_WrdAlloc( 100 );
+    unsigned Hash[4];
+    char Buffer[1000];
+    FILE * pFile;
+    if ( pFileName == NULL || (pFile = fopen( pFileName, "r" )) == NULL )
+        return vCache;
+    while ( fgets( Buffer, 1000, pFile ) )
+    {
+        if ( sscanf( Buffer, "%8x%8x %8x%8x", Hash, Hash+1, Hash+2, Hash+3 ) != 4 )
+            continue;
+        Vec_WrdPush( vCache, ((word)Hash[0] << 32) | Hash[1] );
+        Vec_WrdPush( vCache, ((word)Hash[2] << 32) | Hash[3] );
+    }
+    fclose( pFile );
+    return vCache;
+}
+int Abc_NtkHieCecCacheLookup( Vec_Wrd_t * vCache, word * pHashes )
+{
+    int i;
+    for ( i = 0; i + 1 < Vec_WrdSize(vCache); i += 2 )
+        if ( Vec_WrdEntry(vCache, i) == pHashes[0] && Vec_WrdEntry(vCache, i+1) == pHashes[1] )
+            return 1;
+    return 0;
+}
+void Abc_NtkHieCecCacheWrite( char * pFileName, Vec_Ptr_t * vPairs )
+{
+    Hie_CecPair_t * pPair;
+    FILE * pFile;
+    int i;
+    if ( pFileName == NULL )
+        return;
+    if ( (pFile = fopen( pFileName, "a" )) == NULL )
+    {
+        printf( "Cannot open cache file \"%s\" for writing.\n", pFileName );
+        return;
+    }
+    Vec_PtrForEachEntry( Hie_CecPair_t *, vPairs, pPair, i )
+        if ( !pPair->fCached && pPair->Status == 1 )
+            fprintf( pFile, "%08x%08x %08x%08x %s\n", 
+                (unsigned)(pPair->Hashes[0] >> 32), (unsigned)pPair->Hashes[0], 
+                (unsigned)(pPair->Hashes[1] >> 32), (unsigned)pPair->Hashes[1], 
+                Abc_NtkName(pPair->pNtks[0]) );
+    fclose( pFile );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the two hierarchical designs without flattening.]
+
+  Description [Matches the modules of the two designs by name and
+  signature, and proves each pair of modules with the instances of the
+  submodules treated as cut points. Since the submodules are proved too,
+  the designs are equivalent if all pairs are proved. The pairs proved
+  before (found in the cache by the structural hashes of both sides) are
+  skipped and the newly proved pairs are added to the cache. Returns 1 if
+  the designs are proved equivalent; returns -1 if the hierarchies do not
+  match or if some pair is not proved, because the cut points may hide
+  the equivalence.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkHieCecModules( Abc_Ntk_t * pNtks[2], Vec_Ptr_t * vMods[2], char * pCacheName, int nThreads, Cec_ParCec_t * pPars )
+{
+    Vec_Ptr_t * vPairs = Vec_PtrAlloc( Vec_PtrSize(vMods[0]) );
+    Vec_Ptr_t * vTodo, * vBoxes[2];
+    Vec_Wrd_t * vCache;
+    Hie_CecPair_t * pPair;
+    Abc_Ntk_t * pModel, * pModel1;
+    int i, n, nCached = 0, nProved = 0, RetValue = 1;
+    abctime clk = Abc_Clock();
+    // match the modules
+    if ( Vec_PtrSize(vMods[0]) != Vec_PtrSize(vMods[1]) )
+    {
+        if ( pPars->fVerbose )
+            printf( "The designs have different numbers of modules (%d and %d).\n", Vec_PtrSize(vMods[0]), Vec_PtrSize(vMods[1]) );
+        Vec_PtrFree( vPairs );
+        return -1;
+    }
+    Vec_PtrForEachEntry( Abc_Ntk_t *, vMods[0], pModel, i )
+    {
+        if ( pModel == pNtks[0] )
+            pModel1 = pNtks[1];
+        else
+        {
+            pModel1 = pNtks[1]->pDesign ? Abc_DesFindModelByName( pNtks[1]->pDesign, Abc_NtkName(pModel) ) : NULL;
+            if ( pModel1 == NULL || pModel1 == pNtks[1] || pModel1->iStep < 0 )
+            {
+                if ( pPars->fVerbose )
+                    printf( "Module \"%s\" has no match in the second design.\n", Abc_NtkName(pModel) );
+                RetValue = -1;
+                break;
+            }
+        }
+        vBoxes[0] = Abc_NtkHasBlackbox(pModel)  ? NULL : Abc_NtkHieCecBoxes( pModel );
+        vBoxes[1] = Abc_NtkHasBlackbox(pModel1) ? NULL : Abc_NtkHieCecBoxes( pModel1 );
+        if ( !Abc_NtkHieCecMatch( pModel, pModel1, vBoxes[0], vBoxes[1], pModel == pNtks[0] ) )
+        {
+            if ( pPars->fVerbose )
+                printf( "Module \"%s\" has different signatures in the two designs.\n", Abc_NtkName(pModel) );
+            RetValue = -1;
+        }
+        else if ( vBoxes[0] != NULL )
+        {
+            pPair = ABC_CALLOC( Hie_CecPair_t, 1 );
+            pPair->pNtks[0] = pModel;
+            pPair->pNtks[1] = pModel1;
+            for ( n = 0; n < 2; n++ )
+            {
+                pPair->pGias[n]   = Abc_NtkHieCecDeriveModule( pPair->pNtks[n], vBoxes[n] );
+                pPair->Hashes[n]  = Abc_NtkHieCecHash( pPair->pGias[n] );
+            }
+            pPair->Status = -1;
+            Vec_PtrPush( vPairs, pPair );
+        }
+        if ( vBoxes[0] ) Vec_PtrFree( vBoxes[0] );
+        if ( vBoxes[1] ) Vec_PtrFree( vBoxes[1] );
+        if ( RetValue == -1 )
+            break;
+    }
+    if ( RetValue == -1 )
+    {
+        Vec_PtrForEachEntry( Hie_CecPair_t *, vPairs, pPair, i )
+        {
+            Gia_ManStop( pPair->pGias[0] );
+            Gia_ManStop( pPair->pGias[1] );
+            ABC_FREE( pPair );
+        }
+        Vec_PtrFree( vPairs );
+        return -1;
+    }
+    // skip the pairs proved before
+    vCache = Abc_NtkHieCecCacheRead( pCacheName );
+    Vec_PtrForEachEntry( Hie_CecPair_t *, vPairs, pPair, i )
+    {
+        if ( Abc_NtkHieCecCacheLookup( vCache, pPair->Hashes ) )
+        {
+            pPair->Status = 1;
+            pPair->fCached = 1;
+            nCached++;
+        }
+    }
+    Vec_WrdFree( vCache );
+    // prove the remaining pairs
+    vTodo = Vec_PtrAlloc( Vec_PtrSize(vPairs) );
+    Vec_PtrForEachEntry( Hie_CecPair_t *, vPairs, pPair, i )
+        if ( !pPair->fCached )
+        {
+            pPair->pMiter = Abc_NtkHieCecMiter( pPair->pGias[0], pPair->pGias[1] );
+            Vec_PtrPush( vTodo, pPair );
+        }
+    Abc_NtkHieCecProvePairs( vTodo, nThreads, pPars->TimeLimit );
+    Vec_PtrFree( vTodo );
+    Vec_PtrForEachEntry( Hie_CecPair_t *, vPairs, pPair, i )
+    {
+        if ( pPair->fCached )
+            continue;
+        nProved += (pPair->Status == 1);
+        if ( pPair->Status != 1 )
+            RetValue = -1;
+        if ( pPars->fVeryVerbose || (pPars->fVerbose && pPair->Status != 1) )
+        {
+            printf( "Module %-24s :  CI =%6d  CO =%6d  And =%8d  ", Abc_NtkName(pPair->pNtks[0]), 
+                Gia_ManCiNum(pPair->pGias[0]), Gia_ManCoNum(pPair->pGias[0]), Gia_ManAndNum(pPair->pMiter) );
+            printf( "%-10s", pPair->Status == 1 ? "proved" : (pPair->Status == 0 ? "differs" : "undecided") );
+            Abc_PrintTime( 1, "Time", pPair->Time );
+        }
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Modules = %d.  Cached = %d.  Proved = %d.  Failed = %d.  ", 
+            Vec_PtrSize(vPairs), nCached, nProved, Vec_PtrSize(vPairs) - nCached - nProved );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Abc_NtkHieCecCacheWrite( pCacheName, vPairs );
+    Vec_PtrForEachEntry( Hie_CecPair_t *, vPairs, pPair, i )
+    {
+        Gia_ManStop( pPair->pGias[0] );
+        Gia_ManStop( pPair->pGias[1] );
+        if ( pPair->pMiter )
+            Gia_ManStop( pPair->pMiter );
+        ABC_FREE( pPair );
+    }
+    Vec_PtrFree( vPairs );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs equivalence checking of two hierarchical designs.]
+
+  Description [First tries to prove the designs module by module (see
+  Abc_NtkHieCecModules). If this fails, flattens the designs and checks
+  them using the regular CEC. Returns 1 if the designs are equivalent,
+  0 if they are not, and -1 if undecided.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkHieCecTwo( char * pFileNames[2], char * pCacheName, int nThreads, Cec_ParCec_t * pPars )
+{
+    Abc_Ntk_t * pNtks[2] = { NULL, NULL }, * pModel;
+    Vec_Ptr_t * vMods[2] = { NULL, NULL };
+    Gia_Man_t * pGias[2], * pMiter;
+    int i, n, fBlackbox = 0, RetValue = -1;
+    abctime clk = Abc_Clock();
+    // read the designs
+    for ( n = 0; n < 2; n++ )
+    {
+        pNtks[n] = Io_ReadBlifMv( pFileNames[n], 0, 1 );
+        if ( pNtks[n] == NULL )
+        {
+            printf( "Reading BLIF file \"%s\" has failed.\n", pFileNames[n] );
+            goto finish;
+        }
+        if ( Abc_NtkLatchNum(pNtks[n]) )
+        {
+            printf( "Hierarchical CEC cannot be applied to the sequential design \"%s\".\n", pFileNames[n] );
+            goto finish;
+        }
+        if ( Abc_NtkCheckRecursive(pNtks[n]) )
+            goto finish;
+        // order nodes/boxes of all models
+        if ( pNtks[n]->pDesign )
+        {
+            Vec_PtrForEachEntry( Abc_Ntk_t *, pNtks[n]->pDesign->vModules, pModel, i )
+                pModel->pData = Abc_NtkDfsBoxes( pModel );
+        }
+        else
+            pNtks[n]->pData = Abc_NtkDfsBoxes( pNtks[n] );
+        vMods[n] = Abc_NtkCollectHie( pNtks[n] );
+        Vec_PtrForEachEntry( Abc_Ntk_t *, vMods[n], pModel, i )
+            fBlackbox |= Abc_NtkHasBlackbox( pModel );
+    }
+    if ( pPars->fVerbose )
+        Abc_PrintTime( 1, "Reading designs", Abc_Clock() - clk );
+    // prove the designs module by module
+    RetValue = Abc_NtkHieCecModules( pNtks, vMods, pCacheName, nThreads, pPars );
+    if ( RetValue == 1 )
+    {
+        if ( !pPars->fSilent )
+        {
+            printf( "Networks are equivalent.  " );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        goto finish;
+    }
+    if ( fBlackbox )
+    {
+        if ( !pPars->fSilent )
+            printf( "Hierarchical CEC has failed and the designs with black boxes cannot be flattened.\n" );
+        goto finish;
+    }
+    // flatten the designs and check them as a whole
+    if ( pPars->fVerbose )
+        printf( "Hierarchical CEC has failed. Flattening the designs.\n" );
+    for ( n = 0; n < 2; n++ )
+        pGias[n] = Abc_NtkDeriveFlatGia( pNtks[n] );
+    pMiter = Gia_ManMiter( pGias[0], pGias[1], 0, 1, 0, 0, pPars->fVerbose );
+    if ( pMiter )
+    {
+        RetValue = Cec_ManVerify( pMiter, pPars );
+        Gia_ManStop( pMiter );
+    }
+    Gia_ManStop( pGias[0] );
+    Gia_ManStop( pGias[1] );
+finish:
+    for ( n = 0; n < 2; n++ )
+    {
+        if ( vMods[n] )
+            Vec_PtrFree( vMods[n] );
+        if ( pNtks[n] == NULL )
+            continue;
+        if ( pNtks[n]->pDesign )
+        {
+            Vec_PtrForEachEntry( Abc_Ntk_t *, pNtks[n]->pDesign->vModules, pModel, i )
+                if ( pModel->pData )
+                    Vec_PtrFree( (Vec_Ptr_t *)pModel->pData ), pModel->pData = NULL;
+        }
+        else if ( pNtks[n]->pData )
+            Vec_PtrFree( (Vec_Ptr_t *)pNtks[n]->pData ), pNtks[n]->pData = NULL;
+        Abc_NtkDelete( pNtks[n] );
+    }
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
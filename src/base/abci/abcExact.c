@@ -31,6 +31,19 @@
 #include "proof/cec/cec.h"
 #include "sat/bsat/satSolver.h"
 
+#include <sys/stat.h>
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -264,6 +277,9 @@ struct Ses_Man_t_
     int          nDepthOffset;          /* offset where depth variables start */
 
     int          fHitResLimit;          /* SAT solver gave up due to resource limit */
+    int          nThreads;              /* number of threads to try several numbers of gates concurrently */
+    int       (* pFuncStop)( int );     /* callback to terminate the SAT solver (called with the number of gates) */
+    int          fThreadRand;           /* use the thread-local random generator (set in thread copies) */
 
     abctime      timeSat;               /* SAT runtime */
     abctime      timeSatSat;            /* SAT runtime (sat instance) */
@@ -322,6 +338,10 @@ struct Ses_Store_t_
     sat_solver       * pSat;                           /* own SAT solver instance to reuse when calling exact algorithm */
     FILE             * pDebugEntries;                  /* debug unsynth. (rl) entries */
     char             * szDBName;                       /* if given, database is written every time a new entry is added */
+    char             * szJournal;                      /* if given, journal shared by concurrent processes */
+    long               nJournalOffset;                 /* number of bytes of the journal read so far */
+    long               nJournalSize;                   /* size of the journal when it was last read */
+    int                nThreads;                       /* number of threads used by exact synthesis */
 
     /* statistics */
     unsigned long      nCutCount;                      /* number of cuts investigated */
@@ -426,6 +446,8 @@ static inline void Ses_StoreClean( Ses_Store_t * pStore )
 
     if ( pStore->szDBName )
         ABC_FREE( pStore->szDBName );
+    if ( pStore->szJournal )
+        ABC_FREE( pStore->szJournal );
     ABC_FREE( pStore );
 }
 
@@ -624,17 +646,161 @@ static void Ses_StoreWrite( Ses_Store_t * pStore, const char * pFilename, int fS
     fclose( pFile );
 }
 
+/***********************************************************************
+
+  Synopsis    [Database journal shared by concurrent processes.]
+
+***********************************************************************/
+
+// The journal given to bms_start -J is an append-only file separate from the
+// database. Each entry is written with a single append as one record
+//   | tag | nbytes | truth[4] | nvars | times[8] | reslimit | network | checksum |
+// where network is stored in the same format as in Ses_StoreWrite. The
+// records added by other processes are read when the store misses and the
+// file has grown since the last read. A record that was only partially
+// written (e.g., because the process was killed) fails the checksum and is
+// skipped by searching for the next tag.
+
+#define SES_STORE_JOURNAL_TAG 0x31534553 /* "SES1" */
+
+static inline int Ses_StoreNetworkSize( char * pNetwork )
+{
+    return pNetwork ? 3 + 4 * pNetwork[ABC_EXACT_SOL_NGATES] + 2 + pNetwork[ABC_EXACT_SOL_NVARS] : 3;
+}
+
+static inline unsigned Ses_StoreJournalChecksum( char * pData, int nBytes )
+{
+    unsigned uSum = 0;
+    int i;
+    for ( i = 0; i < nBytes; ++i )
+        uSum = uSum * 16777619 ^ (unsigned char)pData[i];
+    return uSum;
+}
+
+// appends one entry to the journal
+static void Ses_StoreJournalAppend( const char * pFilename, word * pTruth, int nVars, int * pArrTimeProfile, char * pNetwork, int fResLimit )
+{
+    char pBuffer[1024], * p = pBuffer + 2 * sizeof( int );
+    int pTimes[8] = {0}, nBytes, Tag = SES_STORE_JOURNAL_TAG;
+    unsigned uSum;
+    FILE * pFile;
+
+    memcpy( pTimes, pArrTimeProfile, sizeof( int ) * nVars );
+    memcpy( p, pTruth, sizeof( word ) * 4 );     p += sizeof( word ) * 4;
+    memcpy( p, &nVars, sizeof( int ) );          p += sizeof( int );
+    memcpy( p, pTimes, sizeof( int ) * 8 );      p += sizeof( int ) * 8;
+    memcpy( p, &fResLimit, sizeof( int ) );      p += sizeof( int );
+    if ( pNetwork )
+        memcpy( p, pNetwork, Ses_StoreNetworkSize( pNetwork ) );
+    else
+        memset( p, 0, 3 );
+    p += Ses_StoreNetworkSize( pNetwork );
+    nBytes = p - ( pBuffer + 2 * sizeof( int ) );
+    uSum = Ses_StoreJournalChecksum( pBuffer + 2 * sizeof( int ), nBytes );
+    memcpy( p, &uSum, sizeof( unsigned ) );      p += sizeof( unsigned );
+    memcpy( pBuffer, &Tag, sizeof( int ) );
+    memcpy( pBuffer + sizeof( int ), &nBytes, sizeof( int ) );
+    assert( p - pBuffer <= 1024 );
+
+    /* the record is written by one system call at the end of the file */
+    pFile = fopen( pFilename, "ab" );
+    if ( pFile == NULL )
+    {
+        printf( "cannot open file \"%s\" for appending\n", pFilename );
+        return;
+    }
+    fwrite( pBuffer, sizeof( char ), p - pBuffer, pFile );
+    fclose( pFile );
+}
+
+// returns 1 if the file is a journal (an empty file is a journal)
+static int Ses_StoreJournalCheck( const char * pFilename )
+{
+    int Tag = 0, RetValue;
+    FILE * pFile = fopen( pFilename, "rb" );
+    if ( pFile == NULL )
+        return 1;
+    RetValue = fread( &Tag, sizeof( int ), 1, pFile );
+    fclose( pFile );
+    return RetValue == 0 || Tag == SES_STORE_JOURNAL_TAG;
+}
+
+static int Ses_StoreInsertEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char * pSol, int fResLimit );
+static inline void Ses_StoreCountEntry( Ses_Store_t * pStore, int nVars, char * pSol, int fResLimit );
+
+// reads the records added since the last call; returns the number of new entries
+static int Ses_StoreJournalRead( Ses_Store_t * pStore )
+{
+    char pBuffer[1024], * p;
+    word pTruth[4];
+    int pTimes[8], pHeader[2], nVars, fResLimit, nAdded = 0, nSkipped = 0;
+    long Pos;
+    unsigned uSum;
+    char * pNetwork;
+    FILE * pFile;
+    struct stat Stat;
+
+    /* nothing to do unless the file has grown */
+    if ( stat( pStore->szJournal, &Stat ) != 0 || (long)Stat.st_size == pStore->nJournalSize )
+        return 0;
+    pStore->nJournalSize = (long)Stat.st_size;
+
+    pFile = fopen( pStore->szJournal, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    fseek( pFile, pStore->nJournalOffset, SEEK_SET );
+    while ( 1 )
+    {
+        Pos = ftell( pFile );
+        if ( fread( pHeader, sizeof( int ), 2, pFile ) != 2 )
+            break;
+        if ( pHeader[0] != SES_STORE_JOURNAL_TAG || pHeader[1] < 75 || pHeader[1] > 1024 - 12 ||
+             fread( pBuffer, sizeof( char ), pHeader[1] + sizeof( unsigned ), pFile ) != pHeader[1] + sizeof( unsigned ) ||
+             ( memcpy( &uSum, pBuffer + pHeader[1], sizeof( unsigned ) ), uSum != Ses_StoreJournalChecksum( pBuffer, pHeader[1] ) ) )
+        {
+            /* the record at the end may still be written by another process */
+            if ( feof( pFile ) )
+                break;
+            /* skip the damaged record */
+            fseek( pFile, Pos + 1, SEEK_SET );
+            pStore->nJournalOffset = Pos + 1;
+            nSkipped++;
+            continue;
+        }
+        pStore->nJournalOffset = ftell( pFile );
+        p = pBuffer;
+        memcpy( pTruth, p, sizeof( word ) * 4 );     p += sizeof( word ) * 4;
+        memcpy( &nVars, p, sizeof( int ) );          p += sizeof( int );
+        memcpy( pTimes, p, sizeof( int ) * 8 );      p += sizeof( int ) * 8;
+        memcpy( &fResLimit, p, sizeof( int ) );      p += sizeof( int );
+        pNetwork = NULL;
+        if ( p[0] != '\0' )
+        {
+            pNetwork = ABC_CALLOC( char, Ses_StoreNetworkSize( p ) );
+            memcpy( pNetwork, p, Ses_StoreNetworkSize( p ) );
+        }
+        if ( Ses_StoreInsertEntry( pStore, pTruth, nVars, pTimes, pNetwork, fResLimit ) )
+        {
+            Ses_StoreCountEntry( pStore, nVars, pNetwork, fResLimit );
+            nAdded++;
+        }
+        else
+            ABC_FREE( pNetwork );
+    }
+    fclose( pFile );
+    if ( nSkipped && pStore->fVerbose )
+        printf( "skipped %d bytes of damaged records in file \"%s\"\n", nSkipped, pStore->szJournal );
+    return nAdded;
+}
+
 // pArrTimeProfile is normalized
 // returns 1 if and only if a new TimesEntry has been created
-int Ses_StoreAddEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char * pSol, int fResLimit )
+static int Ses_StoreInsertEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char * pSol, int fResLimit )
 {
-    int key, fAdded;
+    int key;
     Ses_TruthEntry_t * pTEntry;
     Ses_TimesEntry_t * pTiEntry;
 
-    if ( pSol )
-        Abc_ExactNormalizeArrivalTimesForNetwork( nVars, pArrTimeProfile, pSol );
-
     key = Ses_StoreTableHash( pTruth, nVars );
     pTEntry = pStore->pEntries[key];
 
@@ -666,30 +832,27 @@ int Ses_StoreAddEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pAr
             pTiEntry = pTiEntry->next;
     }
 
-    /* entry does not yet exist, so create new one and enqueue */
-    if ( !pTiEntry )
-    {
-        pTiEntry = ABC_CALLOC( Ses_TimesEntry_t, 1 );
-        Ses_StoreTimesCopy( pTiEntry->pArrTimeProfile, pArrTimeProfile, nVars );
-        pTiEntry->pNetwork = pSol;
-        pTiEntry->fResLimit = fResLimit;
-        pTiEntry->next = pTEntry->head;
-        pTEntry->head = pTiEntry;
+    /* item was already present */
+    if ( pTiEntry )
+        return 0;
 
-        /* item has been added */
-        fAdded = 1;
-        pStore->nEntriesCount++;
-        if ( pSol )
-            pStore->nValidEntriesCount++;
-    }
-    else
-    {
-        //assert( 0 );
-        /* item was already present */
-        fAdded = 0;
-    }
+    /* entry does not yet exist, so create new one and enqueue */
+    pTiEntry = ABC_CALLOC( Ses_TimesEntry_t, 1 );
+    Ses_StoreTimesCopy( pTiEntry->pArrTimeProfile, pArrTimeProfile, nVars );
+    pTiEntry->pNetwork = pSol;
+    pTiEntry->fResLimit = fResLimit;
+    pTiEntry->next = pTEntry->head;
+    pTEntry->head = pTiEntry;
+
+    /* item has been added */
+    pStore->nEntriesCount++;
+    if ( pSol )
+        pStore->nValidEntriesCount++;
+    return 1;
+}
 
-    /* statistics */
+static inline void Ses_StoreCountEntry( Ses_Store_t * pStore, int nVars, char * pSol, int fResLimit )
+{
     if ( pSol )
     {
         if ( fResLimit )
@@ -716,10 +879,29 @@ int Ses_StoreAddEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pAr
             pStore->pUnsynthesizedImp[nVars]++;
         }
     }
+}
+
+// pArrTimeProfile is normalized
+// returns 1 if and only if a new TimesEntry has been created
+int Ses_StoreAddEntry( Ses_Store_t * pStore, word * pTruth, int nVars, int * pArrTimeProfile, char * pSol, int fResLimit )
+{
+    int fAdded;
+
+    if ( pSol )
+        Abc_ExactNormalizeArrivalTimesForNetwork( nVars, pArrTimeProfile, pSol );
+
+    fAdded = Ses_StoreInsertEntry( pStore, pTruth, nVars, pArrTimeProfile, pSol, fResLimit );
+
+    /* statistics */
+    Ses_StoreCountEntry( pStore, nVars, pSol, fResLimit );
 
     if ( fAdded && pStore->szDBName )
         Ses_StoreWrite( pStore, pStore->szDBName, 1, 0, 0, 0 );
 
+    /* the journal keeps the same entries as the database */
+    if ( fAdded && pStore->szJournal && pSol && !fResLimit )
+        Ses_StoreJournalAppend( pStore->szJournal, pTruth, nVars, pArrTimeProfile, pSol, fResLimit );
+
     return fAdded;
 }
 
@@ -1108,6 +1290,11 @@ static void Ses_ManCreateVars( Ses_Man_t * pSes, int nGates )
     else
         pSes->pSat = sat_solver_new();
     sat_solver_setnvars( pSes->pSat, pSes->nSimVars + pSes->nOutputVars + pSes->nGateVars + pSes->nSelectVars + pSes->nDepthVars );
+    if ( pSes->pFuncStop )
+    {
+        sat_solver_set_runid( pSes->pSat, nGates );
+        sat_solver_set_stop_func( pSes->pSat, pSes->pFuncStop );
+    }
 }
 
 /**Function*************************************************************
@@ -2249,8 +2436,16 @@ static int Ses_ManFindNetworkExactCEGAR( Ses_Man_t * pSes, int nGates, char ** p
     if ( !Ses_CheckGatesConsistency( pSes, nGates ) )
         return 3;
 
+    /* thread copies use the thread-local generator, seeded by the number of gates,
+       so that the result does not depend on which thread solves which instance */
+    if ( pSes->fThreadRand )
+    {
+        Abc_Random( 1 );
+        for ( i = 0; i < nGates; ++i )
+            Abc_Random( 0 );
+    }
     for ( i = 0; i < pSes->nRandRowAssigns; ++i )
-        Abc_TtSetBit( pSes->pTtValues, rand() % pSes->nRows );
+        Abc_TtSetBit( pSes->pTtValues, (pSes->fThreadRand ? Abc_Random(0) : (unsigned)rand()) % pSes->nRows );
 
     fRes = Ses_ManFindNetworkExact( pSes, nGates );
     if ( fRes != 1 ) return fRes;
@@ -2279,6 +2474,154 @@ static int Ses_ManFindNetworkExactCEGAR( Ses_Man_t * pSes, int nGates, char ** p
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Concurrent sweep over the number of gates.]
+
+  Description [Each thread owns a copy of the manager with its own SAT
+  solver and repeatedly takes the next number of gates. Once some number of
+  gates is decided (found, impossible, or gave up), the runs with a larger
+  number of gates are stopped because the sequential bottom-up search
+  would never reach them.]
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Ses_ThShare_t_ Ses_ThShare_t;
+struct Ses_ThShare_t_
+{
+    Ses_Man_t *     pSes;       /* the original manager */
+    int             nFirst;     /* the first number of gates in the sweep */
+    int             nNext;      /* the next number of gates to try */
+    Vec_Int_t *     vResults;   /* the result for each number of gates (-1 if unknown) */
+    Vec_Ptr_t *     vSols;      /* the solution for each number of gates */
+    volatile int    StopLimit;  /* the number of gates above which the runs are not needed */
+    pthread_mutex_t Mutex;      /* protects the data above */
+};
+
+/* the stop limit of the sweep served by this thread */
+static ABC_THREAD_LOCAL volatile int * s_pSesStopLimit = NULL;
+static int Ses_ManCallBackToStop( int RunId ) { return s_pSesStopLimit && RunId > *s_pSesStopLimit; }
+
+static Ses_Man_t * Ses_ManDupThread( Ses_Man_t * p )
+{
+    Ses_Man_t * pNew = ABC_CALLOC( Ses_Man_t, 1 );
+    memcpy( pNew, p, sizeof( Ses_Man_t ) );
+    pNew->pSat            = NULL;
+    pNew->vPolar          = Vec_IntAlloc( 100 );
+    pNew->vAssump         = Vec_IntAlloc( 10 );
+    pNew->vStairDecVars   = Vec_IntDup( p->vStairDecVars );
+    pNew->fVeryVerbose    = 0;
+    pNew->fSatVerbose     = 0;
+    pNew->fReasonVerbose  = 0;
+    pNew->pFuncStop       = Ses_ManCallBackToStop;
+    pNew->fThreadRand     = 1;
+    pNew->timeSat = pNew->timeSatSat = pNew->timeSatUnsat = pNew->timeSatUndef = pNew->timeInstance = 0;
+    pNew->nSatCalls = pNew->nUnsatCalls = pNew->nUndefCalls = 0;
+    return pNew;
+}
+
+static void Ses_ManFreeThread( Ses_Man_t * pSes, Ses_Man_t * p )
+{
+    /* accumulate statistics in the original manager */
+    pSes->timeSat      += p->timeSat;
+    pSes->timeSatSat   += p->timeSatSat;
+    pSes->timeSatUnsat += p->timeSatUnsat;
+    pSes->timeSatUndef += p->timeSatUndef;
+    pSes->timeInstance += p->timeInstance;
+    pSes->nSatCalls    += p->nSatCalls;
+    pSes->nUnsatCalls  += p->nUnsatCalls;
+    pSes->nUndefCalls  += p->nUndefCalls;
+    if ( p->pSat )
+        sat_solver_delete( p->pSat );
+    Vec_IntFree( p->vPolar );
+    Vec_IntFree( p->vAssump );
+    Vec_IntFree( p->vStairDecVars );
+    ABC_FREE( p );
+}
+
+static void * Ses_ManWorkerThread( void * pArg )
+{
+    Ses_ThShare_t * pShare = (Ses_ThShare_t *)pArg;
+    Ses_Man_t * pSes;
+    char * pSol;
+    int nGates, fRes;
+
+    pthread_mutex_lock( &pShare->Mutex );
+    pSes = Ses_ManDupThread( pShare->pSes );
+    pthread_mutex_unlock( &pShare->Mutex );
+    s_pSesStopLimit = &pShare->StopLimit;
+    while ( true )
+    {
+        pthread_mutex_lock( &pShare->Mutex );
+        nGates = pShare->nNext++;
+        pthread_mutex_unlock( &pShare->Mutex );
+        if ( nGates > pShare->StopLimit )
+            break;
+
+        pSol = NULL;
+        fRes = Ses_ManFindNetworkExactCEGAR( pSes, nGates, &pSol );
+
+        pthread_mutex_lock( &pShare->Mutex );
+        Vec_IntFillExtra( pShare->vResults, nGates - pShare->nFirst + 1, -1 );
+        Vec_IntWriteEntry( pShare->vResults, nGates - pShare->nFirst, fRes );
+        Vec_PtrSetEntry( pShare->vSols, nGates - pShare->nFirst, pSol );
+        if ( fRes != 2 && nGates < pShare->StopLimit )
+            pShare->StopLimit = nGates;
+        pthread_mutex_unlock( &pShare->Mutex );
+    }
+    pthread_mutex_lock( &pShare->Mutex );
+    Ses_ManFreeThread( pShare->pSes, pSes );
+    pthread_mutex_unlock( &pShare->Mutex );
+    s_pSesStopLimit = NULL;
+    return NULL;
+}
+
+static char * Ses_ManFindMinimumSizeConcurrent( Ses_Man_t * pSes, int nGates )
+{
+    pthread_t WorkerThread[64];
+    Ses_ThShare_t Share, * pShare = &Share;
+    char * pSol = NULL;
+    int i, fRes = 2, status, nThreads = Abc_MinInt( pSes->nThreads, 64 );
+
+    pShare->pSes     = pSes;
+    pShare->nFirst   = nGates + 1;
+    pShare->nNext    = nGates + 1;
+    pShare->vResults = Vec_IntAlloc( 16 );
+    pShare->vSols    = Vec_PtrAlloc( 16 );
+    pShare->StopLimit = ABC_INFINITY;
+    pthread_mutex_init( &pShare->Mutex, NULL );
+
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Ses_ManWorkerThread, (void *)pShare );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+
+    /* the first decided number of gates gives the result */
+    Vec_IntForEachEntry( pShare->vResults, fRes, i )
+        if ( fRes != 2 )
+            break;
+    assert( i < Vec_IntSize( pShare->vResults ) && pShare->nFirst + i == pShare->StopLimit );
+    pSes->nGates = pShare->nFirst + i;
+    if ( fRes == 0 )
+        pSes->fHitResLimit = 1;
+    else if ( fRes == 1 )
+    {
+        pSol = (char *)Vec_PtrEntry( pShare->vSols, i );
+        Vec_PtrWriteEntry( pShare->vSols, i, NULL );
+    }
+
+    Vec_PtrFreeFree( pShare->vSols );
+    Vec_IntFree( pShare->vResults );
+    pthread_mutex_destroy( &pShare->Mutex );
+    return pSol;
+}
+
+#endif // pthreads are used
+
 // find minimum size by increasing the number of gates
 static char * Ses_ManFindMinimumSizeBottomUp( Ses_Man_t * pSes )
 {
@@ -2300,6 +2643,15 @@ static char * Ses_ManFindMinimumSizeBottomUp( Ses_Man_t * pSes )
 
     Abc_DebugPrintIntInt( " (%d/%d)", nGates, pSes->nMaxGates, pSes->fVeryVerbose );
 
+#ifdef ABC_USE_PTHREADS
+    if ( pSes->nThreads > 1 )
+    {
+        pSol = Ses_ManFindMinimumSizeConcurrent( pSes, nGates );
+        Abc_DebugErase( pSes->nDebugOffset + ( pSes->nGates >= 10 ? 5 : 4 ), pSes->fVeryVerbose );
+        return pSol;
+    }
+#endif
+
     while ( true )
     {
         ++nGates;
@@ -2411,7 +2763,7 @@ static char * Ses_ManFindMinimumSize( Ses_Man_t * pSes )
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int fVerbose )
+Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int nThreads, int fVerbose )
 {
     Ses_Man_t * pSes;
     char * pSol;
@@ -2425,6 +2777,7 @@ Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
 
     pSes = Ses_ManAlloc( pTruth, nVars, nFunc, nMaxDepth, pArrTimeProfile, 0, nBTLimit, fVerbose );
     pSes->nStartGates = nStartGates;
+    pSes->nThreads = nThreads;
     pSes->fReasonVerbose = 0;
     pSes->fSatVerbose = 0;
     if ( fVerbose )
@@ -2447,7 +2800,7 @@ Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
     return pNtk;
 }
 
-Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int fVerbose )
+Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int nThreads, int fVerbose )
 {
     Ses_Man_t * pSes;
     char * pSol;
@@ -2461,6 +2814,7 @@ Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
 
     pSes = Ses_ManAlloc( pTruth, nVars, nFunc, nMaxDepth, pArrTimeProfile, 1, nBTLimit, fVerbose );
     pSes->nStartGates = nStartGates;
+    pSes->nThreads = nThreads;
     pSes->fVeryVerbose = 1;
     pSes->fExtractVerbose = 0;
     pSes->fSatVerbose = 0;
@@ -2516,30 +2870,30 @@ void Abc_ExactTestSingleOutput( int fVerbose )
 
     pNtk = Abc_NtkFromTruthTable( pTruth, 4 );
 
-    pNtk2 = Abc_NtkFindExact( pTruth, 4, 1, -1, NULL, 0, 0, fVerbose );
+    pNtk2 = Abc_NtkFindExact( pTruth, 4, 1, -1, NULL, 0, 0, 1, fVerbose );
     Abc_NtkShortNames( pNtk2 );
     Abc_NtkCecSat( pNtk, pNtk2, 10000, 0 );
     assert( pNtk2 );
     assert( Abc_NtkNodeNum( pNtk2 ) == 6 );
     Abc_NtkDelete( pNtk2 );
 
-    pNtk3 = Abc_NtkFindExact( pTruth, 4, 1, 3, NULL, 0, 0, fVerbose );
+    pNtk3 = Abc_NtkFindExact( pTruth, 4, 1, 3, NULL, 0, 0, 1, fVerbose );
     Abc_NtkShortNames( pNtk3 );
     Abc_NtkCecSat( pNtk, pNtk3, 10000, 0 );
     assert( pNtk3 );
     assert( Abc_NtkLevel( pNtk3 ) <= 3 );
     Abc_NtkDelete( pNtk3 );
 
-    pNtk4 = Abc_NtkFindExact( pTruth, 4, 1, 9, pArrTimeProfile, 50000, 0, fVerbose );
+    pNtk4 = Abc_NtkFindExact( pTruth, 4, 1, 9, pArrTimeProfile, 50000, 0, 1, fVerbose );
     Abc_NtkShortNames( pNtk4 );
     Abc_NtkCecSat( pNtk, pNtk4, 10000, 0 );
     assert( pNtk4 );
     assert( Abc_NtkLevel( pNtk4 ) <= 9 );
     Abc_NtkDelete( pNtk4 );
 
-    assert( !Abc_NtkFindExact( pTruth, 4, 1, 2, NULL, 50000, 0, fVerbose ) );
+    assert( !Abc_NtkFindExact( pTruth, 4, 1, 2, NULL, 50000, 0, 1, fVerbose ) );
 
-    assert( !Abc_NtkFindExact( pTruth, 4, 1, 8, pArrTimeProfile, 50000, 0, fVerbose ) );
+    assert( !Abc_NtkFindExact( pTruth, 4, 1, 8, pArrTimeProfile, 50000, 0, 1, fVerbose ) );
 
     Abc_NtkDelete( pNtk );
 }
@@ -2558,27 +2912,27 @@ void Abc_ExactTestSingleOutputAIG( int fVerbose )
     Abc_NtkToAig( pNtk );
     pGia = Abc_NtkAigToGia( pNtk, 1 );
 
-    pGia2 = Gia_ManFindExact( pTruth, 4, 1, -1, NULL, 0, 0, fVerbose );
+    pGia2 = Gia_ManFindExact( pTruth, 4, 1, -1, NULL, 0, 0, 1, fVerbose );
     pMiter = Gia_ManMiter( pGia, pGia2, 0, 1, 0, 0, 1 );
     assert( pMiter );
     Cec_ManVerify( pMiter, pPars );
     Gia_ManStop( pMiter );
 
-    pGia3 = Gia_ManFindExact( pTruth, 4, 1, 3, NULL, 0, 0, fVerbose );
+    pGia3 = Gia_ManFindExact( pTruth, 4, 1, 3, NULL, 0, 0, 1, fVerbose );
     pMiter = Gia_ManMiter( pGia, pGia3, 0, 1, 0, 0, 1 );
     assert( pMiter );
     Cec_ManVerify( pMiter, pPars );
     Gia_ManStop( pMiter );
 
-    pGia4 = Gia_ManFindExact( pTruth, 4, 1, 9, pArrTimeProfile, 50000, 0, fVerbose );
+    pGia4 = Gia_ManFindExact( pTruth, 4, 1, 9, pArrTimeProfile, 50000, 0, 1, fVerbose );
     pMiter = Gia_ManMiter( pGia, pGia4, 0, 1, 0, 0, 1 );
     assert( pMiter );
     Cec_ManVerify( pMiter, pPars );
     Gia_ManStop( pMiter );
 
-    assert( !Gia_ManFindExact( pTruth, 4, 1, 2, NULL, 50000, 0, fVerbose ) );
+    assert( !Gia_ManFindExact( pTruth, 4, 1, 2, NULL, 50000, 0, 1, fVerbose ) );
 
-    assert( !Gia_ManFindExact( pTruth, 4, 1, 8, pArrTimeProfile, 50000, 0, fVerbose ) );
+    assert( !Gia_ManFindExact( pTruth, 4, 1, 8, pArrTimeProfile, 50000, 0, 1, fVerbose ) );
 
     Gia_ManStop( pGia );
     Gia_ManStop( pGia2 );
@@ -2613,12 +2967,13 @@ int Abc_ExactInputNum()
     return 8;
 }
 // start exact store manager
-void Abc_ExactStart( int nBTLimit, int fMakeAIG, int fVerbose, int fVeryVerbose, const char * pFilename )
+void Abc_ExactStart( int nBTLimit, int fMakeAIG, int nThreads, int fVerbose, int fVeryVerbose, const char * pFilename, const char * pJournal )
 {
     if ( !s_pSesStore )
     {
         s_pSesStore = Ses_StoreAlloc( nBTLimit, fMakeAIG, fVerbose );
         s_pSesStore->fVeryVerbose = fVeryVerbose;
+        s_pSesStore->nThreads = nThreads;
         if ( pFilename )
         {
             Ses_StoreRead( s_pSesStore, pFilename, 1, 0, 0, 0 );
@@ -2626,6 +2981,17 @@ void Abc_ExactStart( int nBTLimit, int fMakeAIG, int fVerbose, int fVeryVerbose,
             s_pSesStore->szDBName = ABC_CALLOC( char, strlen( pFilename ) + 1 );
             strcpy( s_pSesStore->szDBName, pFilename );
         }
+        if ( pJournal && !Ses_StoreJournalCheck( pJournal ) )
+            printf( "file \"%s\" is not a journal and will not be used\n", pJournal );
+        else if ( pJournal )
+        {
+            int nEntries;
+            s_pSesStore->szJournal = ABC_CALLOC( char, strlen( pJournal ) + 1 );
+            strcpy( s_pSesStore->szJournal, pJournal );
+            nEntries = Ses_StoreJournalRead( s_pSesStore );
+            if ( fVerbose )
+                printf( "read %d entries from journal\n", nEntries );
+        }
         if ( s_pSesStore->fVeryVerbose )
         {
             s_pSesStore->pDebugEntries = fopen( "bms.debug", "w" );
@@ -2761,7 +3127,8 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
 
     *Cost = ABC_INFINITY;
 
-    if ( Ses_StoreGetEntry( s_pSesStore, pTruth, nVars, pNormalArrTime, &pSol ) )
+    if ( Ses_StoreGetEntry( s_pSesStore, pTruth, nVars, pNormalArrTime, &pSol ) ||
+         ( s_pSesStore->szJournal && Ses_StoreJournalRead( s_pSesStore ) && Ses_StoreGetEntry( s_pSesStore, pTruth, nVars, pNormalArrTime, &pSol ) ) )
     {
         s_pSesStore->nCacheHits++;
         s_pSesStore->pCacheHits[nVars]++;
@@ -2793,6 +3160,7 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
         pSes->fVeryVerbose = s_pSesStore->fVeryVerbose;
         pSes->pSat = s_pSesStore->pSat;
         pSes->nStartGates = nVars - 2;
+        pSes->nThreads = s_pSesStore->nThreads;
 
         while ( pSes->nMaxDepth ) /* there is improvement */
         {
@@ -2999,7 +3367,7 @@ void Abc_ExactStoreTest( int fVerbose )
     }
     Abc_NodeFreeNames( vNames );
 
-    Abc_ExactStart( 10000, 1, fVerbose, 0, NULL );
+    Abc_ExactStart( 10000, 1, 1, fVerbose, 0, NULL, NULL );
 
     assert( !Abc_ExactBuildNode( pTruth, 4, pArrTimeProfile, pFanins, pNtk ) );
 
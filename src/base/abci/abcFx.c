@@ -24,6 +24,15 @@
 #include "misc/vec/vecHsh.h"
 #include "opt/fxch/Fxch.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -83,6 +92,25 @@ ABC_NAMESPACE_IMPL_START
 
 */
 
+#define FX_PAR_MAX 64
+
+typedef struct Fx_Ext_t_ Fx_Ext_t;
+struct Fx_Ext_t_
+{
+    int             iDiv;       // the divisor to extract
+    int             iCubeNew;   // the first cube of the new divisor
+    int             nCompls;    // the number of complements
+    int             nDivMux[3]; // 0 = mux, 1 = compl mux, 2 = no mux
+    int             fWarning;   // the warning flag
+    Vec_Int_t *     vCubesS;    // single cubes for the given divisor
+    Vec_Int_t *     vCubesD;    // cube pairs for the given divisor
+    Vec_Int_t *     vCompls;    // complemented attribute of each cube pair
+    Vec_Int_t *     vCubeFree;  // cube-free divisor
+    Vec_Int_t *     vDiv;       // selected divisor
+    Vec_Int_t *     vDivs;      // divisors with changed weights (fDouble, Weight, nLits, Lits)
+    Vec_Int_t *     vSCC;       // single cubes containment cubes
+};
+
 typedef struct Fx_Man_t_ Fx_Man_t;
 struct Fx_Man_t_
 {
@@ -99,18 +127,16 @@ struct Fx_Man_t_
     Vec_Int_t *     vVarCube;   // mapping ObjId into its first cube
     Vec_Int_t *     vLevels;    // variable levels
     // temporary data to update the data-structure when a divisor is extracted
-    Vec_Int_t *     vCubesS;    // single cubes for the given divisor
-    Vec_Int_t *     vCubesD;    // cube pairs for the given divisor
-    Vec_Int_t *     vCompls;    // complemented attribute of each cube pair
-    Vec_Int_t *     vCubeFree;  // cube-free divisor
-    Vec_Int_t *     vDiv;       // selected divisor
+    Vec_Ptr_t *     vExts;      // divisors extracted in one round
     Vec_Int_t *     vSCC;       // single cubes containment cubes
+    Vec_Int_t *     vSkipped;   // divisors skipped in the current round
+    Vec_Int_t *     vMarks;     // the last round when the node was updated
+    int             nRounds;    // the number of rounds
     // statistics 
     abctime         timeStart;  // starting time
     int             nVars;      // original problem variables
     int             nLits;      // the number of SOP literals
     int             nDivs;      // the number of extracted divisors
-    int             nCompls;    // the number of complements
     int             nPairsS;    // number of lit pairs
     int             nPairsD;    // number of cube pairs
     int             nDivsS;     // single cube divisors
@@ -118,6 +144,7 @@ struct Fx_Man_t_
 };
 
 static inline int Fx_ManGetFirstVarCube( Fx_Man_t * p, Vec_Int_t * vCube ) { return Vec_IntEntry( p->vVarCube, Vec_IntEntry(vCube, 0) ); }
+static inline Fx_Ext_t * Fx_ManExt( Fx_Man_t * p, int i )                   { return (Fx_Ext_t *)Vec_PtrEntry( p->vExts, i );                }
 
 #define Fx_ManForEachCubeVec( vVec, vCubes, vCube, i )           \
     for ( i = 0; (i < Vec_IntSize(vVec)) && ((vCube) = Vec_WecEntry(vCubes, Vec_IntEntry(vVec, i))); i++ )
@@ -306,9 +333,9 @@ int Abc_NtkFxCheck( Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int fCanonDivs, int fVerbose, int fVeryVerbose )
+int Abc_NtkFxPerformBatch( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int fCanonDivs, int nBatchSize, int nThreads, int fVerbose, int fVeryVerbose )
 {
-    extern int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fCanonDivs, int fVerbose, int fVeryVerbose );
+    extern int Fx_FastExtractInt( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fCanonDivs, int nBatchSize, int nThreads, int fVerbose, int fVeryVerbose );
     Vec_Wec_t * vCubes;
     assert( Abc_NtkIsSopLogic(pNtk) );
     // check unique fanins
@@ -320,7 +347,7 @@ int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int f
     // collect information about the covers
     vCubes = Abc_NtkFxRetrieve( pNtk );
     // call the fast extract procedure
-    if ( Fx_FastExtract( vCubes, Abc_NtkObjNumMax(pNtk), nNewNodesMax, LitCountMax, fCanonDivs, fVerbose, fVeryVerbose ) > 0 )
+    if ( Fx_FastExtractInt( vCubes, Abc_NtkObjNumMax(pNtk), nNewNodesMax, LitCountMax, fCanonDivs, nBatchSize, nThreads, fVerbose, fVeryVerbose ) > 0 )
     {
         // update the network
         Abc_NtkFxInsert( pNtk, vCubes );
@@ -334,6 +361,10 @@ int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int f
     Vec_WecFree( vCubes );
     return 0;
 }
+int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int fCanonDivs, int fVerbose, int fVeryVerbose )
+{
+    return Abc_NtkFxPerformBatch( pNtk, nNewNodesMax, LitCountMax, fCanonDivs, 1, 1, fVerbose, fVeryVerbose );
+}
 
 
 
@@ -348,22 +379,49 @@ int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int f
   SeeAlso     []
 
 ***********************************************************************/
-Fx_Man_t * Fx_ManStart( Vec_Wec_t * vCubes )
+Fx_Ext_t * Fx_ExtStart()
 {
-    Fx_Man_t * p;
-    p = ABC_CALLOC( Fx_Man_t, 1 );
-    p->vCubes   = vCubes;
-    // temporary data
+    Fx_Ext_t * p;
+    p = ABC_CALLOC( Fx_Ext_t, 1 );
     p->vCubesS   = Vec_IntAlloc( 100 );
     p->vCubesD   = Vec_IntAlloc( 100 );
     p->vCompls   = Vec_IntAlloc( 100 );
     p->vCubeFree = Vec_IntAlloc( 100 );
     p->vDiv      = Vec_IntAlloc( 100 );
+    p->vDivs     = Vec_IntAlloc( 100 );
     p->vSCC      = Vec_IntAlloc( 100 );
     return p;
 }
+void Fx_ExtStop( Fx_Ext_t * p )
+{
+    Vec_IntFree( p->vCubesS );
+    Vec_IntFree( p->vCubesD );
+    Vec_IntFree( p->vCompls );
+    Vec_IntFree( p->vCubeFree );
+    Vec_IntFree( p->vDiv );
+    Vec_IntFree( p->vDivs );
+    Vec_IntFree( p->vSCC );
+    ABC_FREE( p );
+}
+Fx_Man_t * Fx_ManStart( Vec_Wec_t * vCubes, int nBatchSize )
+{
+    Fx_Man_t * p;
+    int i;
+    p = ABC_CALLOC( Fx_Man_t, 1 );
+    p->vCubes   = vCubes;
+    // temporary data
+    p->vExts     = Vec_PtrAlloc( nBatchSize );
+    for ( i = 0; i < nBatchSize; i++ )
+        Vec_PtrPush( p->vExts, Fx_ExtStart() );
+    p->vSCC      = Vec_IntAlloc( 100 );
+    p->vSkipped  = Vec_IntAlloc( 100 );
+    p->vMarks    = Vec_IntAlloc( 100 );
+    return p;
+}
 void Fx_ManStop( Fx_Man_t * p )
 {
+    Fx_Ext_t * pExt;
+    int i;
 //    Vec_WecFree( p->vCubes );
     Vec_WecFree( p->vLits );
     Vec_IntFree( p->vCounts );
@@ -373,12 +431,12 @@ void Fx_ManStop( Fx_Man_t * p )
     Vec_IntFree( p->vVarCube );
     Vec_IntFree( p->vLevels );
     // temporary data
-    Vec_IntFree( p->vCubesS );
-    Vec_IntFree( p->vCubesD );
-    Vec_IntFree( p->vCompls );
-    Vec_IntFree( p->vCubeFree );
-    Vec_IntFree( p->vDiv );
+    Vec_PtrForEachEntry( Fx_Ext_t *, p->vExts, pExt, i )
+        Fx_ExtStop( pExt );
+    Vec_PtrFree( p->vExts );
     Vec_IntFree( p->vSCC );
+    Vec_IntFree( p->vSkipped );
+    Vec_IntFree( p->vMarks );
     ABC_FREE( p );
 }
 
@@ -748,100 +806,125 @@ void Fx_ManCreateLiterals( Fx_Man_t * p, int nVars )
         if ( Vec_IntEntry(p->vVarCube, Vec_IntEntry(vCube, 0)) == -1 )
             Vec_IntWriteEntry( p->vVarCube, Vec_IntEntry(vCube, 0), i );
 }
-int Fx_ManCubeSingleCubeDivisors( Fx_Man_t * p, Vec_Int_t * vPivot, int fRemove, int fUpdate )
+static inline void Fx_ManDivPush( Vec_Int_t * vDivs, int fDouble, int Weight, Vec_Int_t * vCubeFree )
 {
-    int k, n, Lit, Lit2, iDiv;
+    Vec_IntPush( vDivs, fDouble );
+    Vec_IntPush( vDivs, Weight );
+    Vec_IntPush( vDivs, Vec_IntSize(vCubeFree) );
+    Vec_IntAppend( vDivs, vCubeFree );
+}
+int Fx_ManCubeSingleCubeCollect( Fx_Ext_t * pExt, Vec_Int_t * vPivot )
+{
+    int k, n, Lit, Lit2;
     if ( Vec_IntSize(vPivot) < 2 )
         return 0;
     Vec_IntForEachEntryStart( vPivot, Lit, k, 1 )
     Vec_IntForEachEntryStart( vPivot, Lit2, n, k+1 )
     {
         assert( Lit < Lit2 );
-        Vec_IntClear( p->vCubeFree );
-        Vec_IntPush( p->vCubeFree, Abc_Var2Lit(Abc_LitNot(Lit), 0) );
-        Vec_IntPush( p->vCubeFree, Abc_Var2Lit(Abc_LitNot(Lit2), 1) );
-        iDiv = Hsh_VecManAdd( p->pHash, p->vCubeFree );
-        if ( !fRemove )
-        {
-            if ( Vec_FltSize(p->vWeights) == iDiv )
-            {
-                Vec_FltPush(p->vWeights, -2 + 0.9 - 0.001 * Fx_ManComputeLevelDiv(p, p->vCubeFree));
-                p->nDivsS++;
-            }
-            assert( iDiv < Vec_FltSize(p->vWeights) );
-            Vec_FltAddToEntry( p->vWeights, iDiv, 1 );
-            p->nPairsS++;
-        }
-        else
-        {
-            assert( iDiv < Vec_FltSize(p->vWeights) );
-            Vec_FltAddToEntry( p->vWeights, iDiv, -1 );
-            p->nPairsS--;
-        }
-        if ( fUpdate )
-        {
-            if ( Vec_QueIsMember(p->vPrio, iDiv) )
-                Vec_QueUpdate( p->vPrio, iDiv );
-            else if ( !fRemove )
-                Vec_QuePush( p->vPrio, iDiv );
-        }
+        Vec_IntClear( pExt->vCubeFree );
+        Vec_IntPush( pExt->vCubeFree, Abc_Var2Lit(Abc_LitNot(Lit), 0) );
+        Vec_IntPush( pExt->vCubeFree, Abc_Var2Lit(Abc_LitNot(Lit2), 1) );
+        Fx_ManDivPush( pExt->vDivs, 0, 1, pExt->vCubeFree );
     }
     return Vec_IntSize(vPivot) * (Vec_IntSize(vPivot) - 1) / 2;
 }
-void Fx_ManCubeDoubleCubeDivisors( Fx_Man_t * p, int iFirst, Vec_Int_t * vPivot, int fRemove, int fUpdate, int * fWarning )
+void Fx_ManCubeDoubleCubeCollect( Fx_Man_t * p, Fx_Ext_t * pExt, int iFirst, Vec_Int_t * vPivot, int fRemove )
 {
     Vec_Int_t * vCube;
-    int i, iDiv, Base;
+    int i, Base;
     Vec_WecForEachLevelStart( p->vCubes, vCube, i, iFirst )
     {
         if ( Vec_IntSize(vCube) == 0 || vCube == vPivot )
             continue;
-        if ( Vec_WecIntHasMark(vCube) && Vec_WecIntHasMark(vPivot) && vCube > vPivot )
-            continue;
+        // check the node before the marks, which may be changed by other threads in other nodes
         if ( Vec_IntEntry(vCube, 0) != Vec_IntEntry(vPivot, 0) )
             break;
-        Base = Fx_ManDivFindCubeFree( vCube, vPivot, p->vCubeFree, fWarning );
+        if ( Vec_WecIntHasMark(vCube) && Vec_WecIntHasMark(vPivot) && vCube > vPivot )
+            continue;
+        Base = Fx_ManDivFindCubeFree( vCube, vPivot, pExt->vCubeFree, &pExt->fWarning );
         if ( Base == -1 ) 
         {
             if ( fRemove == 0 )
             {
                 if ( Vec_IntSize( vCube ) > Vec_IntSize( vPivot ) )
-                    Vec_IntPush( p->vSCC, Vec_WecLevelId( p->vCubes, vCube ) );
+                    Vec_IntPush( pExt->vSCC, Vec_WecLevelId( p->vCubes, vCube ) );
                 else
-                    Vec_IntPush( p->vSCC, Vec_WecLevelId( p->vCubes, vPivot ) );
+                    Vec_IntPush( pExt->vSCC, Vec_WecLevelId( p->vCubes, vPivot ) );
             }
             continue;
         }
-        if ( Vec_IntSize(p->vCubeFree) == 4 )
+        if ( Vec_IntSize(pExt->vCubeFree) == 4 )
         { 
-            int Value = Fx_ManDivNormalize( p->vCubeFree );
+            int Value = Fx_ManDivNormalize( pExt->vCubeFree );
             if ( Value == 0 )
-                p->nDivMux[0]++;
+                pExt->nDivMux[0]++;
             else if ( Value == 1 )
-                p->nDivMux[1]++;
+                pExt->nDivMux[1]++;
             else
-                p->nDivMux[2]++;
+                pExt->nDivMux[2]++;
             if ( p->fCanonDivs && Value < 0 )
                 continue;
         }
-        if ( p->LitCountMax && p->LitCountMax < Vec_IntSize(p->vCubeFree) )
+        if ( p->LitCountMax && p->LitCountMax < Vec_IntSize(pExt->vCubeFree) )
             continue;
-        if ( p->fCanonDivs && Vec_IntSize(p->vCubeFree) == 3 )
+        if ( p->fCanonDivs && Vec_IntSize(pExt->vCubeFree) == 3 )
             continue;
-        iDiv = Hsh_VecManAdd( p->pHash, p->vCubeFree );
+        Fx_ManDivPush( pExt->vDivs, 1, Base + Vec_IntSize(pExt->vCubeFree) - 1, pExt->vCubeFree );
+    } 
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates divisor weights using the collected divisors.]
+
+  Description [The divisors are hashed and their weights are updated 
+  in the order of collection, which makes the result independent of 
+  the thread that collected them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fx_ManCommitDivisors( Fx_Man_t * p, Fx_Ext_t * pExt, int fRemove, int fUpdate )
+{
+    Vec_Int_t vCubeFree;
+    int i, k, fDouble, Weight, iDiv;
+    for ( i = 0; i < Vec_IntSize(pExt->vDivs); i += 3 + vCubeFree.nSize )
+    {
+        fDouble  = Vec_IntEntry( pExt->vDivs, i );
+        Weight   = Vec_IntEntry( pExt->vDivs, i+1 );
+        vCubeFree.nSize  = vCubeFree.nCap = Vec_IntEntry( pExt->vDivs, i+2 );
+        vCubeFree.pArray = Vec_IntEntryP( pExt->vDivs, i+3 );
+        iDiv = Hsh_VecManAdd( p->pHash, &vCubeFree );
         if ( !fRemove )
         {
             if ( iDiv == Vec_FltSize(p->vWeights) )
-                Vec_FltPush(p->vWeights, -Vec_IntSize(p->vCubeFree) + 0.9 - 0.0009 * Fx_ManComputeLevelDiv(p, p->vCubeFree));
+            {
+                if ( fDouble )
+                    Vec_FltPush(p->vWeights, -Vec_IntSize(&vCubeFree) + 0.9 - 0.0009 * Fx_ManComputeLevelDiv(p, &vCubeFree));
+                else
+                {
+                    Vec_FltPush(p->vWeights, -2 + 0.9 - 0.001 * Fx_ManComputeLevelDiv(p, &vCubeFree));
+                    p->nDivsS++;
+                }
+            }
             assert( iDiv < Vec_FltSize(p->vWeights) );
-            Vec_FltAddToEntry( p->vWeights, iDiv, Base + Vec_IntSize(p->vCubeFree) - 1 );
-            p->nPairsD++;
+            Vec_FltAddToEntry( p->vWeights, iDiv, Weight );
+            if ( fDouble )
+                p->nPairsD++;
+            else
+                p->nPairsS++;
         }
         else
         {
             assert( iDiv < Vec_FltSize(p->vWeights) );
-            Vec_FltAddToEntry( p->vWeights, iDiv, -(Base + Vec_IntSize(p->vCubeFree) - 1) );
-            p->nPairsD--;
+            Vec_FltAddToEntry( p->vWeights, iDiv, -Weight );
+            if ( fDouble )
+                p->nPairsD--;
+            else
+                p->nPairsS--;
         }
         if ( fUpdate )
         {
@@ -850,24 +933,41 @@ void Fx_ManCubeDoubleCubeDivisors( Fx_Man_t * p, int iFirst, Vec_Int_t * vPivot,
             else if ( !fRemove )
                 Vec_QuePush( p->vPrio, iDiv );
         }
-    } 
+    }
+    Vec_IntClear( pExt->vDivs );
+    for ( k = 0; k < 3; k++ )
+        p->nDivMux[k] += pExt->nDivMux[k], pExt->nDivMux[k] = 0;
+    Vec_IntAppend( p->vSCC, pExt->vSCC );
+    Vec_IntClear( pExt->vSCC );
+}
+int Fx_ManCubeSingleCubeDivisors( Fx_Man_t * p, Fx_Ext_t * pExt, Vec_Int_t * vPivot, int fRemove, int fUpdate )
+{
+    int Count = Fx_ManCubeSingleCubeCollect( pExt, vPivot );
+    Fx_ManCommitDivisors( p, pExt, fRemove, fUpdate );
+    return Count;
+}
+void Fx_ManCubeDoubleCubeDivisors( Fx_Man_t * p, Fx_Ext_t * pExt, int iFirst, Vec_Int_t * vPivot, int fRemove, int fUpdate )
+{
+    Fx_ManCubeDoubleCubeCollect( p, pExt, iFirst, vPivot, fRemove );
+    Fx_ManCommitDivisors( p, pExt, fRemove, fUpdate );
 }
 void Fx_ManCreateDivisors( Fx_Man_t * p )
 {
+    Fx_Ext_t * pExt = Fx_ManExt( p, 0 );
     Vec_Int_t * vCube;
     float Weight;
-    int i, fWarning = 0;
+    int i;
     // alloc hash table
     assert( p->pHash == NULL );
     p->pHash = Hsh_VecManStart( 1000 );
     p->vWeights = Vec_FltAlloc( 1000 );
     // create single-cube two-literal divisors
     Vec_WecForEachLevel( p->vCubes, vCube, i )
-        Fx_ManCubeSingleCubeDivisors( p, vCube, 0, 0 ); // add - no update
+        Fx_ManCubeSingleCubeDivisors( p, pExt, vCube, 0, 0 ); // add - no update
     assert( p->nDivsS == Vec_FltSize(p->vWeights) );
     // create two-cube divisors
     Vec_WecForEachLevel( p->vCubes, vCube, i )
-        Fx_ManCubeDoubleCubeDivisors( p, i+1, vCube, 0, 0, &fWarning ); // add - no update
+        Fx_ManCubeDoubleCubeDivisors( p, pExt, i+1, vCube, 0, 0 ); // add - no update
     // create queue with all divisors
     p->vPrio = Vec_QueAlloc( Vec_FltSize(p->vWeights) );
     Vec_QueSetPriority( p->vPrio, Vec_FltArrayP(p->vWeights) );
@@ -958,69 +1058,89 @@ void Fx_ManFindCommonPairs( Vec_Wec_t * vCubes, Vec_Int_t * vPart0, Vec_Int_t *
 
   Synopsis    [Updates the data-structure when one divisor is selected.]
 
-  Description []
+  Description [The update is split into several steps, so that divisors
+  updating disjoint sets of nodes can be extracted in one round. The steps
+  collecting the divisors with changed weights only read the shared data
+  and can be performed concurrently for different divisors.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
+void Fx_ManUpdateCollect( Fx_Man_t * p, Fx_Ext_t * pExt, int iDiv )
 {
-    Vec_Int_t * vCube, * vCube2, * vLitP = NULL, * vLitN = NULL;
-    Vec_Int_t * vDiv = p->vDiv;
-    int i, k, Lit0, Lit1, iVarNew = 0, RetValue, Level;
+    Vec_Int_t * vDiv = pExt->vDiv;
+    int Lit0, Lit1;
     float Diff = Vec_FltEntry(p->vWeights, iDiv) - (float)((int)Vec_FltEntry(p->vWeights, iDiv));
     assert( Diff > 0.0 && Diff < 1.0 );
 
     // get the divisor and select pivot variables
-    p->nDivs++;
+    pExt->iDiv = iDiv;
     Vec_IntClear( vDiv );
     Vec_IntAppend( vDiv, Hsh_VecReadEntry(p->pHash, iDiv) );
     Fx_ManDivFindPivots( vDiv, &Lit0, &Lit1 );
     assert( Lit0 >= 0 && Lit1 >= 0 );
 
-
-    // collect single-cube-divisor cubes
-    Vec_IntClear( p->vCubesS );
+    // collect single-cube-divisor cubes (they are removed from the literals when the cubes are updated)
+    Vec_IntClear( pExt->vCubesS );
     if ( Vec_IntSize(vDiv) == 2 )
     {
         Fx_ManCompressCubes( p->vCubes, Vec_WecEntry(p->vLits, Abc_LitNot(Lit0)) );
         Fx_ManCompressCubes( p->vCubes, Vec_WecEntry(p->vLits, Abc_LitNot(Lit1)) );
-        Vec_IntTwoRemoveCommon( Vec_WecEntry(p->vLits, Abc_LitNot(Lit0)), Vec_WecEntry(p->vLits, Abc_LitNot(Lit1)), p->vCubesS );
+        Vec_IntTwoFindCommon( Vec_WecEntry(p->vLits, Abc_LitNot(Lit0)), Vec_WecEntry(p->vLits, Abc_LitNot(Lit1)), pExt->vCubesS );
     }
 
     // collect double-cube-divisor cube pairs
     Fx_ManCompressCubes( p->vCubes, Vec_WecEntry(p->vLits, Lit0) );
     Fx_ManCompressCubes( p->vCubes, Vec_WecEntry(p->vLits, Lit1) );
-    Fx_ManFindCommonPairs( p->vCubes, Vec_WecEntry(p->vLits, Lit0), Vec_WecEntry(p->vLits, Lit1), p->vCubesD, p->vCompls, vDiv, p->vCubeFree, fWarning );
-
+    Fx_ManFindCommonPairs( p->vCubes, Vec_WecEntry(p->vLits, Lit0), Vec_WecEntry(p->vLits, Lit1), pExt->vCubesD, pExt->vCompls, vDiv, pExt->vCubeFree, &pExt->fWarning );
+}
+void Fx_ManUpdateRemove( Fx_Man_t * p, Fx_Ext_t * pExt )
+{
+    Vec_Int_t * vCube;
+    int i;
     // subtract cost of single-cube divisors
-    Fx_ManForEachCubeVec( p->vCubesS, p->vCubes, vCube, i )
-        Fx_ManCubeSingleCubeDivisors( p, vCube, 1, 1 );  // remove - update
-    Fx_ManForEachCubeVec( p->vCubesD, p->vCubes, vCube, i )
-        Fx_ManCubeSingleCubeDivisors( p, vCube, 1, 1 );  // remove - update
+    Fx_ManForEachCubeVec( pExt->vCubesS, p->vCubes, vCube, i )
+        Fx_ManCubeSingleCubeCollect( pExt, vCube );  // remove - update
+    Fx_ManForEachCubeVec( pExt->vCubesD, p->vCubes, vCube, i )
+        Fx_ManCubeSingleCubeCollect( pExt, vCube );  // remove - update
 
     // mark the cubes to be removed
-    Vec_WecMarkLevels( p->vCubes, p->vCubesS );
-    Vec_WecMarkLevels( p->vCubes, p->vCubesD );
+    Vec_WecMarkLevels( p->vCubes, pExt->vCubesS );
+    Vec_WecMarkLevels( p->vCubes, pExt->vCubesD );
 
     // subtract cost of double-cube divisors
-    Fx_ManForEachCubeVec( p->vCubesS, p->vCubes, vCube, i )
-        Fx_ManCubeDoubleCubeDivisors( p, Fx_ManGetFirstVarCube(p, vCube), vCube, 1, 1, fWarning );  // remove - update
-    Fx_ManForEachCubeVec( p->vCubesD, p->vCubes, vCube, i )
-        Fx_ManCubeDoubleCubeDivisors( p, Fx_ManGetFirstVarCube(p, vCube), vCube, 1, 1, fWarning );  // remove - update
+    Fx_ManForEachCubeVec( pExt->vCubesS, p->vCubes, vCube, i )
+        Fx_ManCubeDoubleCubeCollect( p, pExt, Fx_ManGetFirstVarCube(p, vCube), vCube, 1 );  // remove - update
+    Fx_ManForEachCubeVec( pExt->vCubesD, p->vCubes, vCube, i )
+        Fx_ManCubeDoubleCubeCollect( p, pExt, Fx_ManGetFirstVarCube(p, vCube), vCube, 1 );  // remove - update
 
     // unmark the cubes to be removed
-    Vec_WecUnmarkLevels( p->vCubes, p->vCubesS );
-    Vec_WecUnmarkLevels( p->vCubes, p->vCubesD );
+    Vec_WecUnmarkLevels( p->vCubes, pExt->vCubesS );
+    Vec_WecUnmarkLevels( p->vCubes, pExt->vCubesD );
+}
+void Fx_ManUpdateCubes( Fx_Man_t * p, Fx_Ext_t * pExt )
+{
+    Vec_Int_t * vCube, * vCube2, * vLitP = NULL, * vLitN = NULL;
+    Vec_Int_t * vDiv = pExt->vDiv;
+    int i, k, Lit0, Lit1, iVarNew = 0, RetValue, Level;
 
-    if ( Abc_Lit2Var(Lit0) == Abc_Lit2Var(Lit1) && Vec_IntSize(Hsh_VecReadEntry(p->pHash, iDiv)) == 2 )
+    p->nDivs++;
+    pExt->iCubeNew = -1;
+    Fx_ManDivFindPivots( vDiv, &Lit0, &Lit1 );
+    if ( Vec_IntSize(vDiv) == 2 )
+    {
+        Vec_IntTwoRemove( Vec_WecEntry(p->vLits, Abc_LitNot(Lit0)), pExt->vCubesS );
+        Vec_IntTwoRemove( Vec_WecEntry(p->vLits, Abc_LitNot(Lit1)), pExt->vCubesS );
+    }
+    if ( Abc_Lit2Var(Lit0) == Abc_Lit2Var(Lit1) && Vec_IntSize(vDiv) == 2 )
         goto ExtractFromPairs;
 
     // create new divisor
     iVarNew = Vec_WecSize( p->vLits ) / 2;
     assert( Vec_IntSize(p->vVarCube) == iVarNew );
+    pExt->iCubeNew = Vec_WecSize(p->vCubes);
     Vec_IntPush( p->vVarCube, Vec_WecSize(p->vCubes) );
     vCube = Vec_WecPushLevel( p->vCubes );
     Vec_IntPush( vCube, iVarNew );
@@ -1047,7 +1167,7 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
     vLitN = Vec_WecPushLevel( p->vLits );
     vLitP = Vec_WecEntry( p->vLits, Vec_WecSize(p->vLits) - 2 );
     // create updated single-cube divisor cubes
-    Fx_ManForEachCubeVec( p->vCubesS, p->vCubes, vCube, i )
+    Fx_ManForEachCubeVec( pExt->vCubesS, p->vCubes, vCube, i )
     {
         RetValue  = Vec_IntRemove1( vCube, Abc_LitNot(Lit0) );
         RetValue += Vec_IntRemove1( vCube, Abc_LitNot(Lit1) );
@@ -1059,15 +1179,15 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
     // create updated double-cube divisor cube pairs
 ExtractFromPairs:
     k = 0;
-    p->nCompls = 0;
-    assert( Vec_IntSize(p->vCubesD) % 2 == 0 );
-    assert( Vec_IntSize(p->vCubesD) == 2 * Vec_IntSize(p->vCompls) );
-    for ( i = 0; i < Vec_IntSize(p->vCubesD); i += 2 )
+    pExt->nCompls = 0;
+    assert( Vec_IntSize(pExt->vCubesD) % 2 == 0 );
+    assert( Vec_IntSize(pExt->vCubesD) == 2 * Vec_IntSize(pExt->vCompls) );
+    for ( i = 0; i < Vec_IntSize(pExt->vCubesD); i += 2 )
     {
-        int fCompl = Vec_IntEntry(p->vCompls, i/2);
-        p->nCompls += fCompl;
-        vCube  = Vec_WecEntry( p->vCubes, Vec_IntEntry(p->vCubesD, i) );
-        vCube2 = Vec_WecEntry( p->vCubes, Vec_IntEntry(p->vCubesD, i+1) );
+        int fCompl = Vec_IntEntry(pExt->vCompls, i/2);
+        pExt->nCompls += fCompl;
+        vCube  = Vec_WecEntry( p->vCubes, Vec_IntEntry(pExt->vCubesD, i) );
+        vCube2 = Vec_WecEntry( p->vCubes, Vec_IntEntry(pExt->vCubesD, i+1) );
         RetValue  = Fx_ManDivRemoveLits( vCube, vDiv, fCompl );  // cube 2*i
         RetValue += Fx_ManDivRemoveLits( vCube2, vDiv, fCompl ); // cube 2*i+1
         assert( RetValue == Vec_IntSize(vDiv) || RetValue == Vec_IntSize( vDiv ) + 1);
@@ -1087,53 +1207,68 @@ ExtractFromPairs:
         p->nLits -= Vec_IntSize(vDiv) + Vec_IntSize(vCube2) - 2;
 
         // remove second cube
-        Vec_IntWriteEntry( p->vCubesD, k++, Vec_WecLevelId(p->vCubes, vCube) );
+        Vec_IntWriteEntry( pExt->vCubesD, k++, Vec_WecLevelId(p->vCubes, vCube) );
         Vec_IntClear( vCube2 ); 
     }
-    assert( k == Vec_IntSize(p->vCubesD) / 2 );
-    Vec_IntShrink( p->vCubesD, k );
-    Vec_IntSort( p->vCubesD, 0 );
+    assert( k == Vec_IntSize(pExt->vCubesD) / 2 );
+    Vec_IntShrink( pExt->vCubesD, k );
+    Vec_IntSort( pExt->vCubesD, 0 );
     //Vec_IntSort( vLitN, 0 );
     //Vec_IntSort( vLitP, 0 );
-
+}
+void Fx_ManUpdateAdd( Fx_Man_t * p, Fx_Ext_t * pExt )
+{
+    Vec_Int_t * vCube;
+    int i;
     // add cost of single-cube divisors
-    Fx_ManForEachCubeVec( p->vCubesS, p->vCubes, vCube, i )
-        Fx_ManCubeSingleCubeDivisors( p, vCube, 0, 1 );  // add - update
-    Fx_ManForEachCubeVec( p->vCubesD, p->vCubes, vCube, i )
-        Fx_ManCubeSingleCubeDivisors( p, vCube, 0, 1 );  // add - update
+    Fx_ManForEachCubeVec( pExt->vCubesS, p->vCubes, vCube, i )
+        Fx_ManCubeSingleCubeCollect( pExt, vCube );  // add - update
+    Fx_ManForEachCubeVec( pExt->vCubesD, p->vCubes, vCube, i )
+        Fx_ManCubeSingleCubeCollect( pExt, vCube );  // add - update
 
     // mark the cubes to be removed
-    Vec_WecMarkLevels( p->vCubes, p->vCubesS );
-    Vec_WecMarkLevels( p->vCubes, p->vCubesD );
+    Vec_WecMarkLevels( p->vCubes, pExt->vCubesS );
+    Vec_WecMarkLevels( p->vCubes, pExt->vCubesD );
 
     // add cost of double-cube divisors
-    Fx_ManForEachCubeVec( p->vCubesS, p->vCubes, vCube, i )
-        Fx_ManCubeDoubleCubeDivisors( p, Fx_ManGetFirstVarCube(p, vCube), vCube, 0, 1, fWarning );  // add - update
-    Fx_ManForEachCubeVec( p->vCubesD, p->vCubes, vCube, i )
-        Fx_ManCubeDoubleCubeDivisors( p, Fx_ManGetFirstVarCube(p, vCube), vCube, 0, 1, fWarning );  // add - update
+    Fx_ManForEachCubeVec( pExt->vCubesS, p->vCubes, vCube, i )
+        Fx_ManCubeDoubleCubeCollect( p, pExt, Fx_ManGetFirstVarCube(p, vCube), vCube, 0 );  // add - update
+    Fx_ManForEachCubeVec( pExt->vCubesD, p->vCubes, vCube, i )
+        Fx_ManCubeDoubleCubeCollect( p, pExt, Fx_ManGetFirstVarCube(p, vCube), vCube, 0 );  // add - update
 
     // unmark the cubes to be removed
-    Vec_WecUnmarkLevels( p->vCubes, p->vCubesS );
-    Vec_WecUnmarkLevels( p->vCubes, p->vCubesD );
-
-    // Deal with SCC
-    if ( Vec_IntSize( p->vSCC ) )
+    Vec_WecUnmarkLevels( p->vCubes, pExt->vCubesS );
+    Vec_WecUnmarkLevels( p->vCubes, pExt->vCubesD );
+}
+void Fx_ManUpdateSCC( Fx_Man_t * p, Fx_Ext_t * pExt )
+{
+    Vec_Int_t * vCube;
+    int i;
+    if ( Vec_IntSize( p->vSCC ) == 0 )
+        return;
+    Vec_IntUniqify( p->vSCC );
+    Fx_ManForEachCubeVec( p->vSCC, p->vCubes, vCube, i )
     {
-        Vec_IntUniqify( p->vSCC );
-        Fx_ManForEachCubeVec( p->vSCC, p->vCubes, vCube, i )
-        {
-            Fx_ManCubeDoubleCubeDivisors( p, Fx_ManGetFirstVarCube(p, vCube), vCube, 1, 1, fWarning );  // remove - update
-            Vec_IntClear( vCube );
-        }
-        Vec_IntClear( p->vSCC );
+        Fx_ManCubeDoubleCubeDivisors( p, pExt, Fx_ManGetFirstVarCube(p, vCube), vCube, 1, 1 );  // remove - update
+        Vec_IntClear( vCube );
     }
+    Vec_IntClear( p->vSCC );
+}
+void Fx_ManUpdateFinish( Fx_Man_t * p, Fx_Ext_t * pExt )
+{
+    Vec_Int_t * vCube, * vCube2;
+    Vec_Int_t * vDiv = pExt->vDiv;
+    int i, Lit0;
+
+    // Deal with SCC
+    Fx_ManUpdateSCC( p, pExt );
     // add cost of the new divisor
     if ( Vec_IntSize(vDiv) > 2 )
     {
-        vCube  = Vec_WecEntry( p->vCubes, Vec_WecSize(p->vCubes) - 2 );
-        vCube2 = Vec_WecEntry( p->vCubes, Vec_WecSize(p->vCubes) - 1 );
-        Fx_ManCubeSingleCubeDivisors( p, vCube,  0, 1 );  // add - update
-        Fx_ManCubeSingleCubeDivisors( p, vCube2, 0, 1 );  // add - update
+        vCube  = Vec_WecEntry( p->vCubes, pExt->iCubeNew );
+        vCube2 = Vec_WecEntry( p->vCubes, pExt->iCubeNew + 1 );
+        Fx_ManCubeSingleCubeDivisors( p, pExt, vCube,  0, 1 );  // add - update
+        Fx_ManCubeSingleCubeDivisors( p, pExt, vCube2, 0, 1 );  // add - update
         Vec_IntForEachEntryStart( vCube, Lit0, i, 1 )
             Vec_WecPush( p->vLits, Lit0, Vec_WecLevelId(p->vCubes, vCube) );
         Vec_IntForEachEntryStart( vCube2, Lit0, i, 1 )
@@ -1143,11 +1278,162 @@ ExtractFromPairs:
     // remove these cubes from the lit array of the divisor
     Vec_IntForEachEntry( vDiv, Lit0, i )
     {
-        Vec_IntTwoRemove( Vec_WecEntry(p->vLits, Abc_Lit2Var(Lit0)), p->vCubesD );
-        if ( (p->nCompls && i > 1) || Vec_IntSize( vDiv ) == 2 ) // the last two lits are possibly complemented
-            Vec_IntTwoRemove( Vec_WecEntry(p->vLits, Abc_LitNot(Abc_Lit2Var(Lit0))), p->vCubesD );
+        Vec_IntTwoRemove( Vec_WecEntry(p->vLits, Abc_Lit2Var(Lit0)), pExt->vCubesD );
+        if ( (pExt->nCompls && i > 1) || Vec_IntSize( vDiv ) == 2 ) // the last two lits are possibly complemented
+            Vec_IntTwoRemove( Vec_WecEntry(p->vLits, Abc_LitNot(Abc_Lit2Var(Lit0))), pExt->vCubesD );
     }
+}
+void Fx_ManUpdate( Fx_Man_t * p, int iDiv )
+{
+    Fx_Ext_t * pExt = Fx_ManExt( p, 0 );
+    Fx_ManUpdateCollect( p, pExt, iDiv );
+    Fx_ManUpdateRemove( p, pExt );
+    Fx_ManCommitDivisors( p, pExt, 1, 1 );
+    Fx_ManUpdateCubes( p, pExt );
+    Fx_ManUpdateAdd( p, pExt );
+    Fx_ManCommitDivisors( p, pExt, 0, 1 );
+    Fx_ManUpdateFinish( p, pExt );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects divisors to be extracted in one round.]
+
+  Description [Divisors are taken from the queue in the order of their
+  weights. A divisor is selected if the nodes whose cubes it changes are 
+  not changed by the divisors selected before it. The weights of such 
+  divisors do not depend on each other, so they can be extracted together. 
+  The remaining divisors are returned to the queue.]
+               
+  SideEffects []
+
+  SeeAlso     []
 
+***********************************************************************/
+int Fx_ManSelectDivs( Fx_Man_t * p, int nDivsMax )
+{
+    Fx_Ext_t * pExt;
+    Vec_Int_t * vCube;
+    int i, k, iDiv, fConflict, nTries = 0, nDivs = 0;
+    Vec_IntFillExtra( p->vMarks, Vec_IntSize(p->vVarCube), 0 );
+    Vec_IntClear( p->vSkipped );
+    p->nRounds++;
+    while ( nDivs < nDivsMax && nTries++ < 2 * nDivsMax && Vec_QueTopPriority(p->vPrio) > 0.0 )
+    {
+        pExt = Fx_ManExt( p, nDivs );
+        iDiv = Vec_QuePop( p->vPrio );
+        Fx_ManUpdateCollect( p, pExt, iDiv );
+        // check if the nodes are changed by the divisors selected before
+        fConflict = 0;
+        Fx_ManForEachCubeVec( pExt->vCubesS, p->vCubes, vCube, i )
+            fConflict |= (Vec_IntEntry(p->vMarks, Vec_IntEntry(vCube, 0)) == p->nRounds);
+        Fx_ManForEachCubeVec( pExt->vCubesD, p->vCubes, vCube, i )
+            fConflict |= (Vec_IntEntry(p->vMarks, Vec_IntEntry(vCube, 0)) == p->nRounds);
+        if ( fConflict )
+        {
+            Vec_IntPush( p->vSkipped, iDiv );
+            continue;
+        }
+        Fx_ManForEachCubeVec( pExt->vCubesS, p->vCubes, vCube, i )
+            Vec_IntWriteEntry( p->vMarks, Vec_IntEntry(vCube, 0), p->nRounds );
+        Fx_ManForEachCubeVec( pExt->vCubesD, p->vCubes, vCube, i )
+            Vec_IntWriteEntry( p->vMarks, Vec_IntEntry(vCube, 0), p->nRounds );
+        nDivs++;
+    }
+    Vec_IntForEachEntry( p->vSkipped, iDiv, k )
+        Vec_QuePush( p->vPrio, iDiv );
+    return nDivs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Extracts the selected divisors.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Fx_Par_t_ Fx_Par_t;
+struct Fx_Par_t_
+{
+    Fx_Man_t *      pMan;
+    int             nDivs;
+    int             fAdd;
+    int             iNext;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;
+#endif
+};
+static inline void Fx_ManCollectOne( Fx_Par_t * p, int i )
+{
+    if ( p->fAdd )
+        Fx_ManUpdateAdd( p->pMan, Fx_ManExt(p->pMan, i) );
+    else
+        Fx_ManUpdateRemove( p->pMan, Fx_ManExt(p->pMan, i) );
+}
+#ifdef ABC_USE_PTHREADS
+void * Fx_ManCollectThread( void * pArg )
+{
+    Fx_Par_t * p = (Fx_Par_t *)pArg;
+    while ( 1 )
+    {
+        int i;
+        pthread_mutex_lock( &p->Mutex );
+        i = p->iNext++;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( i >= p->nDivs )
+            break;
+        Fx_ManCollectOne( p, i );
+    }
+    return NULL;
+}
+#endif
+void Fx_ManCollect( Fx_Man_t * pMan, int nDivs, int fAdd, int nThreads )
+{
+    Fx_Par_t Par, * p = &Par;
+    int i;
+    p->pMan  = pMan;
+    p->nDivs = nDivs;
+    p->fAdd  = fAdd;
+    p->iNext = 0;
+    nThreads = Abc_MinInt( nThreads, nDivs );
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[FX_PAR_MAX];
+        int status;
+        pthread_mutex_init( &p->Mutex, NULL );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Fx_ManCollectThread, (void *)p );
+            assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+            pthread_join( WorkerThread[i], NULL );
+        pthread_mutex_destroy( &p->Mutex );
+        return;
+    }
+#endif
+    for ( i = 0; i < nDivs; i++ )
+        Fx_ManCollectOne( p, i );
+}
+void Fx_ManUpdateDivs( Fx_Man_t * p, int nDivs, int nThreads )
+{
+    int i;
+    Fx_ManCollect( p, nDivs, 0, nThreads );
+    for ( i = 0; i < nDivs; i++ )
+        Fx_ManCommitDivisors( p, Fx_ManExt(p, i), 1, 1 );
+    for ( i = 0; i < nDivs; i++ )
+        Fx_ManUpdateCubes( p, Fx_ManExt(p, i) );
+    Fx_ManCollect( p, nDivs, 1, nThreads );
+    for ( i = 0; i < nDivs; i++ )
+    {
+        Fx_ManCommitDivisors( p, Fx_ManExt(p, i), 0, 1 );
+        Fx_ManUpdateFinish( p, Fx_ManExt(p, i) );
+    }
 }
 
 /**Function*************************************************************
@@ -1156,21 +1442,26 @@ ExtractFromPairs:
 
   Description [J. Rajski and J. Vasudevamurthi, "The testability-
   preserving concurrent decomposition and factorization of Boolean
-  expressions", IEEE TCAD, Vol. 11, No. 6, June 1992, pp. 778-793.]
+  expressions", IEEE TCAD, Vol. 11, No. 6, June 1992, pp. 778-793.
+  When nBatchSize is more than 1, up to this many divisors updating 
+  disjoint sets of nodes are extracted in each round, and the divisors
+  with changed weights are collected using nThreads threads.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fCanonDivs, int fVerbose, int fVeryVerbose )
+int Fx_FastExtractInt( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fCanonDivs, int nBatchSize, int nThreads, int fVerbose, int fVeryVerbose )
 {
     int fVeryVeryVerbose = 0;
-    int i, iDiv, fWarning = 0;
+    int i, k, iDiv, nDivs;
     Fx_Man_t * p;
     abctime clk = Abc_Clock();
+    nBatchSize = Abc_MaxInt( nBatchSize, 1 );
+    nThreads = Abc_MinInt( Abc_MaxInt( nThreads, 1 ), FX_PAR_MAX );
     // initialize the data-structure
-    p = Fx_ManStart( vCubes );
+    p = Fx_ManStart( vCubes, nBatchSize );
     p->LitCountMax = LitCountMax;
     p->fCanonDivs = fCanonDivs;
     Fx_ManCreateLiterals( p, ObjIdMax );
@@ -1182,14 +1473,33 @@ int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitC
         Fx_PrintStats( p, Abc_Clock() - clk );
     // perform extraction
     p->timeStart = Abc_Clock();
-    for ( i = 0; i < nNewNodesMax && Vec_QueTopPriority(p->vPrio) > 0.0; i++ )
+    if ( nBatchSize == 1 )
+    {
+        for ( i = 0; i < nNewNodesMax && Vec_QueTopPriority(p->vPrio) > 0.0; i++ )
+        {
+            iDiv = Vec_QuePop(p->vPrio);
+            if ( fVeryVerbose )
+                Fx_PrintDiv( p, iDiv );
+            Fx_ManUpdate( p, iDiv );
+            if ( fVeryVeryVerbose )
+                Fx_PrintDivisors( p );
+        }
+    }
+    else
     {
-        iDiv = Vec_QuePop(p->vPrio);
-        if ( fVeryVerbose )
-            Fx_PrintDiv( p, iDiv );
-        Fx_ManUpdate( p, iDiv, &fWarning );
-        if ( fVeryVeryVerbose )
-            Fx_PrintDivisors( p );
+        // remove the contained cubes found while creating divisors, because
+        // they may belong to any node, while the rounds update disjoint nodes
+        Fx_ManUpdateSCC( p, Fx_ManExt(p, 0) );
+        for ( i = 0; i < nNewNodesMax && Vec_QueTopPriority(p->vPrio) > 0.0; i += nDivs )
+        {
+            nDivs = Fx_ManSelectDivs( p, Abc_MinInt(nBatchSize, nNewNodesMax - i) );
+            if ( fVeryVerbose )
+                for ( k = 0; k < nDivs; k++ )
+                    Fx_PrintDiv( p, Fx_ManExt(p, k)->iDiv );
+            Fx_ManUpdateDivs( p, nDivs, nThreads );
+        }
+        if ( fVerbose )
+            printf( "Extracted %d divisors in %d rounds using %d thread%s.\n", p->nDivs, p->nRounds, nThreads, nThreads > 1 ? "s" : "" );
     }
     if ( fVerbose )
         Fx_PrintStats( p, Abc_Clock() - clk );
@@ -1198,6 +1508,10 @@ int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitC
     Vec_WecRemoveEmpty( vCubes );
     return 1;
 }
+int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fCanonDivs, int fVerbose, int fVeryVerbose )
+{
+    return Fx_FastExtractInt( vCubes, ObjIdMax, nNewNodesMax, LitCountMax, fCanonDivs, 1, 1, fVerbose, fVeryVerbose );
+}
 
 
 
@@ -23,6 +23,18 @@
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
+#include "bdd/reo/reo.h"
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 #endif
 
 ABC_NAMESPACE_IMPL_START
@@ -437,6 +449,258 @@ void * Abc_NtkBuildGlobalBdds( Abc_Ntk_t * pNtk, int nBddSizeMax, int fDropInter
     return dd;
 }
 
+#ifdef ABC_USE_PTHREADS
+
+// the network shared by the threads in the read-only form
+typedef struct Abc_BddShare_t_ Abc_BddShare_t;
+struct Abc_BddShare_t_
+{
+    int             nObjs;        // the number of objects
+    int             nCis;         // the number of CIs
+    int             nCos;         // the number of COs
+    int             nThreads;     // the number of threads
+    int *           pFanins;      // two fanin literals for each AND node
+    int *           pCiNums;      // CI number for each object (-1 if not a CI)
+    int *           pCoLits;      // driver literal for each CO
+    int             iConst1;      // the ID of the constant node
+    int             nBddSizeMax;  // the limit on the live nodes in each manager
+    int             fReorder;     // dynamic variable reordering
+    int             fReverse;     // reverse variable order
+    volatile int    fAbort;       // set to 1 when one manager exceeded the limit
+};
+
+// information given to the thread
+typedef struct Abc_BddThData_t_
+{
+    Abc_BddShare_t * pShare;
+    int              iThread;     // the COs of this thread are iThread, iThread + nThreads, etc
+    DdManager *      dd;          // the manager of this thread
+    DdNode **        pBdds;       // the BDDs of the objects in this manager
+    int *            pRefs;       // the number of fanouts in the cones of this thread
+    DdNode **        pCoBdds;     // the BDDs of the COs built by this thread
+} Abc_BddThData_t;
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the global BDD for one object in the thread's manager.]
+
+  Description [The BDDs of internal nodes are dereferenced as soon as all
+  their fanouts in the cones of this thread are computed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkBuildGlobalBddsParRef_rec( Abc_BddThData_t * p, int iObj )
+{
+    Abc_BddShare_t * s = p->pShare;
+    if ( p->pRefs[iObj]++ > 0 || s->pCiNums[iObj] >= 0 || iObj == s->iConst1 )
+        return;
+    Abc_NtkBuildGlobalBddsParRef_rec( p, Abc_Lit2Var(s->pFanins[2*iObj]) );
+    Abc_NtkBuildGlobalBddsParRef_rec( p, Abc_Lit2Var(s->pFanins[2*iObj+1]) );
+}
+static inline void Abc_NtkBuildGlobalBddsParDeref( Abc_BddThData_t * p, int iObj )
+{
+    Abc_BddShare_t * s = p->pShare;
+    if ( --p->pRefs[iObj] > 0 || s->pCiNums[iObj] >= 0 || iObj == s->iConst1 )
+        return;
+    Cudd_RecursiveDeref( p->dd, p->pBdds[iObj] );
+    p->pBdds[iObj] = NULL;
+}
+DdNode * Abc_NtkBuildGlobalBddsPar_rec( Abc_BddThData_t * p, int iObj )
+{
+    Abc_BddShare_t * s = p->pShare;
+    DdNode * bFunc0, * bFunc1;
+    int iLit0, iLit1;
+    if ( p->pBdds[iObj] )
+        return p->pBdds[iObj];
+    if ( s->fAbort )
+        return NULL;
+    if ( Cudd_ReadKeys(p->dd)-Cudd_ReadDead(p->dd) > (unsigned)s->nBddSizeMax )
+    {
+        s->fAbort = 1;
+        return NULL;
+    }
+    assert( s->pCiNums[iObj] == -1 );
+    iLit0 = s->pFanins[2*iObj];
+    iLit1 = s->pFanins[2*iObj+1];
+    bFunc0 = Abc_NtkBuildGlobalBddsPar_rec( p, Abc_Lit2Var(iLit0) );
+    if ( bFunc0 == NULL )
+        return NULL;
+    bFunc1 = Abc_NtkBuildGlobalBddsPar_rec( p, Abc_Lit2Var(iLit1) );
+    if ( bFunc1 == NULL )
+        return NULL;
+    bFunc0 = Cudd_NotCond( bFunc0, Abc_LitIsCompl(iLit0) );
+    bFunc1 = Cudd_NotCond( bFunc1, Abc_LitIsCompl(iLit1) );
+    p->pBdds[iObj] = Cudd_bddAnd( p->dd, bFunc0, bFunc1 );  Cudd_Ref( p->pBdds[iObj] );
+    Abc_NtkBuildGlobalBddsParDeref( p, Abc_Lit2Var(iLit0) );
+    Abc_NtkBuildGlobalBddsParDeref( p, Abc_Lit2Var(iLit1) );
+    return p->pBdds[iObj];
+}
+void * Abc_NtkBuildGlobalBddsParThread( void * pArg )
+{
+    Abc_BddThData_t * p = (Abc_BddThData_t *)pArg;
+    Abc_BddShare_t * s = p->pShare;
+    DdNode * bFunc;
+    int i, iCo;
+    // start the manager of this thread
+    p->dd = Cudd_Init( s->nCis, 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+    if ( s->fReorder )
+        Cudd_AutodynEnable( p->dd, CUDD_REORDER_SYMM_SIFT );
+    p->pBdds = ABC_CALLOC( DdNode *, s->nObjs );
+    p->pBdds[s->iConst1] = p->dd->one;  Cudd_Ref( p->dd->one );
+    for ( i = 0; i < s->nObjs; i++ )
+        if ( s->pCiNums[i] >= 0 )
+        {
+            p->pBdds[i] = p->dd->vars[s->fReverse ? s->nCis - 1 - s->pCiNums[i] : s->pCiNums[i]];
+            Cudd_Ref( p->pBdds[i] );
+        }
+    // count the fanouts in the cones of this thread
+    p->pRefs = ABC_CALLOC( int, s->nObjs );
+    for ( iCo = p->iThread; iCo < s->nCos; iCo += s->nThreads )
+        Abc_NtkBuildGlobalBddsParRef_rec( p, Abc_Lit2Var(s->pCoLits[iCo]) );
+    // build the COs of this thread
+    for ( iCo = p->iThread; iCo < s->nCos; iCo += s->nThreads )
+    {
+        bFunc = Abc_NtkBuildGlobalBddsPar_rec( p, Abc_Lit2Var(s->pCoLits[iCo]) );
+        if ( bFunc == NULL )
+            break;
+        p->pCoBdds[iCo] = Cudd_NotCond( bFunc, Abc_LitIsCompl(s->pCoLits[iCo]) );  Cudd_Ref( p->pCoBdds[iCo] );
+        Abc_NtkBuildGlobalBddsParDeref( p, Abc_Lit2Var(s->pCoLits[iCo]) );
+    }
+    // dereference the remaining BDDs
+    for ( i = 0; i < s->nObjs; i++ )
+        if ( p->pBdds[i] )
+            Cudd_RecursiveDeref( p->dd, p->pBdds[i] );
+    ABC_FREE( p->pBdds );
+    ABC_FREE( p->pRefs );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives global BDDs for the COs of the network using threads.]
+
+  Description [Each thread builds every nThreads-th CO in its own manager,
+  reading the network converted into plain arrays.
+  The resulting BDDs are transferred into one manager, which is attached
+  to the network in the same way as by Abc_NtkBuildGlobalBdds().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_NtkBuildGlobalBddsPar( Abc_Ntk_t * pNtk, int nBddSizeMax, int fReorder, int fReverse, int nThreads, int fVerbose )
+{
+    Abc_BddShare_t Share, * s = &Share;
+    Abc_BddThData_t ThData[64];
+    pthread_t WorkerThread[64];
+    Vec_Att_t * pAttMan;
+    Abc_Obj_t * pObj;
+    DdManager * dd;
+    DdNode * bFunc;
+    int i, k, status;
+    assert( Abc_NtkIsStrash(pNtk) );
+    nThreads = Abc_MinInt( nThreads, Abc_MinInt(Abc_NtkCoNum(pNtk), 64) );
+    if ( nThreads < 2 )
+        return Abc_NtkBuildGlobalBdds( pNtk, nBddSizeMax, 1, fReorder, fReverse, fVerbose );
+    // remove dangling nodes
+    Abc_AigCleanup( (Abc_Aig_t *)pNtk->pManFunc );
+    // convert the network into arrays
+    memset( s, 0, sizeof(Abc_BddShare_t) );
+    s->nObjs       = Abc_NtkObjNumMax( pNtk );
+    s->nCis        = Abc_NtkCiNum( pNtk );
+    s->nCos        = Abc_NtkCoNum( pNtk );
+    s->pFanins     = ABC_CALLOC( int, 2 * s->nObjs );
+    s->pCiNums     = ABC_FALLOC( int, s->nObjs );
+    s->pCoLits     = ABC_CALLOC( int, s->nCos );
+    s->iConst1     = Abc_ObjId( Abc_AigConst1(pNtk) );
+    s->nBddSizeMax = nBddSizeMax;
+    s->fReorder    = fReorder;
+    s->fReverse    = fReverse;
+    s->nThreads    = nThreads;
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        s->pCiNums[Abc_ObjId(pObj)] = i;
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        s->pFanins[2*i]   = Abc_Var2Lit( Abc_ObjFaninId0(pObj), Abc_ObjFaninC0(pObj) );
+        s->pFanins[2*i+1] = Abc_Var2Lit( Abc_ObjFaninId1(pObj), Abc_ObjFaninC1(pObj) );
+    }
+    Abc_NtkForEachCo( pNtk, pObj, i )
+        s->pCoLits[i] = Abc_Var2Lit( Abc_ObjFaninId0(pObj), Abc_ObjFaninC0(pObj) );
+    // build the BDDs in parallel
+    memset( ThData, 0, sizeof(Abc_BddThData_t) * nThreads );
+    for ( k = 0; k < nThreads; k++ )
+    {
+        ThData[k].pShare  = s;
+        ThData[k].iThread = k;
+        ThData[k].pCoBdds = ABC_CALLOC( DdNode *, s->nCos );
+        status = pthread_create( WorkerThread + k, NULL, Abc_NtkBuildGlobalBddsParThread, (void *)(ThData + k) );  assert( status == 0 );
+    }
+    for ( k = 0; k < nThreads; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+    }
+    // transfer the results into one manager
+    dd = NULL;
+    if ( !s->fAbort )
+    {
+        dd = Cudd_Init( s->nCis, 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        pAttMan = Vec_AttAlloc( Abc_NtkObjNumMax(pNtk) + 1, dd, (void (*)(void*))Extra_StopManager, NULL, (void (*)(void*,void*))Cudd_RecursiveDeref );
+        Vec_PtrWriteEntry( pNtk->vAttrs, VEC_ATTR_GLOBAL_BDD, pAttMan );
+        if ( fReorder )
+        {
+            // reorder the managers of the threads concurrently and
+            // start from the order of the largest one
+            DdManager * pDds[64];
+            int * pOrders[64], iBest = 0;
+            for ( k = 0; k < nThreads; k++ )
+                pDds[k] = ThData[k].dd;
+            Extra_ReorderManagers( pDds, nThreads, nThreads, 0, pOrders, 0 );
+            for ( k = 1; k < nThreads; k++ )
+                if ( Cudd_ReadKeys(pDds[iBest]) - Cudd_ReadDead(pDds[iBest]) < Cudd_ReadKeys(pDds[k]) - Cudd_ReadDead(pDds[k]) )
+                    iBest = k;
+            Cudd_ShuffleHeap( dd, pOrders[iBest] );
+            for ( k = 0; k < nThreads; k++ )
+                ABC_FREE( pOrders[k] );
+        }
+        Abc_NtkForEachCo( pNtk, pObj, i )
+        {
+            k = i % nThreads;
+            bFunc = Cudd_bddTransfer( ThData[k].dd, dd, ThData[k].pCoBdds[i] );  Cudd_Ref( bFunc );
+            Abc_ObjSetGlobalBdd( pObj, bFunc );
+        }
+        if ( fReorder )
+            Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 1 );
+    }
+    else if ( fVerbose )
+        printf( "Constructing global BDDs is aborted.\n" );
+    // clean up
+    for ( k = 0; k < nThreads; k++ )
+    {
+        for ( i = 0; i < s->nCos; i++ )
+            if ( ThData[k].pCoBdds[i] )
+                Cudd_RecursiveDeref( ThData[k].dd, ThData[k].pCoBdds[i] );
+        ABC_FREE( ThData[k].pCoBdds );
+        Extra_StopManager( ThData[k].dd );
+    }
+    ABC_FREE( s->pFanins );
+    ABC_FREE( s->pCiNums );
+    ABC_FREE( s->pCoLits );
+    return dd;
+}
+
+#else
+
+void * Abc_NtkBuildGlobalBddsPar( Abc_Ntk_t * pNtk, int nBddSizeMax, int fReorder, int fReverse, int nThreads, int fVerbose )
+{
+    return Abc_NtkBuildGlobalBdds( pNtk, nBddSizeMax, 1, fReorder, fReverse, fVerbose );
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Derives the global BDD for one AIG node.]
@@ -21,6 +21,7 @@
 #include "base/abc/abc.h"
 #include "bool/dec/dec.h"
 #include "bool/kit/kit.h"
+#include "opt/dau/dau.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -44,10 +45,13 @@ struct Abc_ManRef_t_
     Vec_Int_t *      vForm;             // temporary
     Vec_Ptr_t *      vVisited;          // temporary
     Vec_Ptr_t *      vLeaves;           // temporary
+    Dau_Cache_t *    pCache;            // the resynthesis cache (or NULL)
+    Vec_Int_t *      vAig;              // the structure from the cache
     // node statistics
     int              nLastGain;
     int              nNodesConsidered;
     int              nNodesRefactored;
+    int              nCacheHits;
     int              nNodesGained;
     int              nNodesBeg;
     int              nNodesEnd;
@@ -138,6 +142,48 @@ int Abc_NodeConeIsConst1( word * pTruth, int nVars )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Converts between factored forms and cached structures.]
+
+  Description [The structure uses variables 1..nVars for the leaves of the
+  factored form, followed by its internal nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dec_Graph_t * Abc_NodeRefactorAigToGraph( Vec_Int_t * vAig, int nVars )
+{
+    Dec_Graph_t * pGraph = Dec_GraphCreate( nVars );
+    Dec_Edge_t eEdge0, eEdge1;
+    int i, iLit0, iLit1;
+    for ( i = 0; i + 1 < Vec_IntSize(vAig); i += 2 )
+    {
+        iLit0  = Vec_IntEntry( vAig, i );
+        iLit1  = Vec_IntEntry( vAig, i+1 );
+        eEdge0 = Dec_EdgeCreate( Abc_Lit2Var(iLit0) - 1, Abc_LitIsCompl(iLit0) );
+        eEdge1 = Dec_EdgeCreate( Abc_Lit2Var(iLit1) - 1, Abc_LitIsCompl(iLit1) );
+        Dec_GraphAddNodeAnd( pGraph, eEdge0, eEdge1 );
+    }
+    iLit0 = Vec_IntEntryLast( vAig );
+    Dec_GraphSetRoot( pGraph, Dec_EdgeCreate( Abc_Lit2Var(iLit0) - 1, Abc_LitIsCompl(iLit0) ) );
+    return pGraph;
+}
+void Abc_NodeRefactorGraphToAig( Dec_Graph_t * pGraph, Vec_Int_t * vAig )
+{
+    Dec_Node_t * pNode;
+    int i;
+    Vec_IntClear( vAig );
+    Dec_GraphForEachNode( pGraph, pNode, i )
+    {
+        Vec_IntPush( vAig, Abc_Var2Lit( pNode->eEdge0.Node + 1, pNode->eEdge0.fCompl ) );
+        Vec_IntPush( vAig, Abc_Var2Lit( pNode->eEdge1.Node + 1, pNode->eEdge1.fCompl ) );
+    }
+    Vec_IntPush( vAig, Abc_Var2Lit( pGraph->eRoot.Node + 1, pGraph->eRoot.fCompl ) );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Resynthesizes the node using refactoring.]
@@ -183,9 +229,22 @@ p->timeTru += Abc_Clock() - clk;
         return Abc_NodeConeIsConst0(pTruth, nVars) ? Dec_GraphCreateConst0() : Dec_GraphCreateConst1();
     }
 
-    // get the factored form
+    // get the factored form (reuse the best known one if the cache is used)
 clk = Abc_Clock();
-    pFForm = (Dec_Graph_t *)Kit_TruthToGraph( (unsigned *)pTruth, nVars, p->vMemory );
+    if ( p->pCache && Dau_CacheLookup( p->pCache, pTruth, nVars, p->vAig ) )
+    {
+        pFForm = Abc_NodeRefactorAigToGraph( p->vAig, nVars );
+        p->nCacheHits++;
+    }
+    else
+    {
+        pFForm = (Dec_Graph_t *)Kit_TruthToGraph( (unsigned *)pTruth, nVars, p->vMemory );
+        if ( p->pCache )
+        {
+            Abc_NodeRefactorGraphToAig( pFForm, p->vAig );
+            Dau_CacheInsert( p->pCache, pTruth, nVars, p->vAig );
+        }
+    }
 p->timeFact += Abc_Clock() - clk;
 
     // mark the fanin boundary 
@@ -258,6 +317,7 @@ Abc_ManRef_t * Abc_NtkManRefStart( int nNodeSizeMax, int nConeSizeMax, int fUseD
     p->vVars        = Vec_PtrAllocTruthTables( Abc_MaxInt(nNodeSizeMax, 6) );
     p->vFuncs       = Vec_PtrAlloc( 100 );
     p->vMemory      = Vec_IntAlloc( 1 << 16 );
+    p->vAig         = Vec_IntAlloc( 100 );
     return p;
 }
 
@@ -277,6 +337,7 @@ void Abc_NtkManRefStop( Abc_ManRef_t * p )
     Vec_PtrFreeFree( p->vFuncs );
     Vec_PtrFree( p->vVars );
     Vec_IntFree( p->vMemory );
+    Vec_IntFree( p->vAig );
     Vec_PtrFree( p->vVisited );
     Vec_StrFree( p->vCube );
     ABC_FREE( p );
@@ -298,6 +359,8 @@ void Abc_NtkManRefPrintStats( Abc_ManRef_t * p )
     printf( "Refactoring statistics:\n" );
     printf( "Nodes considered  = %8d.\n", p->nNodesConsidered );
     printf( "Nodes refactored  = %8d.\n", p->nNodesRefactored );
+    if ( p->pCache )
+        printf( "Cached forms used = %8d.\n", p->nCacheHits );
     printf( "Gain              = %8d. (%6.2f %%).\n", p->nNodesBeg-p->nNodesEnd, 100.0*(p->nNodesBeg-p->nNodesEnd)/p->nNodesBeg );
     ABC_PRT( "Cuts       ", p->timeCut );
     ABC_PRT( "Resynthesis", p->timeRes );
@@ -345,6 +408,10 @@ int Abc_NtkRefactor( Abc_Ntk_t * pNtk, int nNodeSizeMax, int nMinSaved, int nCon
     pManCut = Abc_NtkManCutStart( nNodeSizeMax, nConeSizeMax, 2, 1000 );
     pManRef = Abc_NtkManRefStart( nNodeSizeMax, nConeSizeMax, fUseDcs, fVerbose );
     pManRef->vLeaves   = Abc_NtkManCutReadCutLarge( pManCut );
+    // use the resynthesis cache if it is started
+    pManRef->pCache    = Dau_CacheReadGlobal();
+    if ( pManRef->pCache )
+        Dau_CacheSync( pManRef->pCache );
     // compute the reverse levels if level update is requested
     if ( fUpdateLevel )
         Abc_NtkStartReverseLevels( pNtk, 0 );
@@ -392,6 +459,8 @@ pManRef->timeNtk += Abc_Clock() - clk;
     Extra_ProgressBarStop( pProgress );
 pManRef->timeTotal = Abc_Clock() - clkStart;
     pManRef->nNodesEnd = Abc_NtkNodeNum(pNtk);
+    if ( pManRef->pCache )
+        Dau_CacheSync( pManRef->pCache );
 
     // print statistics of the manager
     if ( fVerbose )
@@ -35,7 +35,11 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Abc_Frame_t * s_GlobalFrame = NULL;
+static Abc_Frame_t * s_MainFrame = NULL;
+static ABC_THREAD_LOCAL Abc_Frame_t * s_PrivateFrame = NULL;
+
+// the frame used by the current thread (its private frame if started)
+#define s_GlobalFrame (s_PrivateFrame ? s_PrivateFrame : s_MainFrame)
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -208,7 +212,8 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
 //    extern void Ivy_TruthManStop();
 //    Abc_HManStop();
 //    undefine_cube_size();
-    Rwt_ManGlobalStop();
+    if ( p != s_PrivateFrame )
+        Rwt_ManGlobalStop();
 //    Ivy_TruthManStop();
     if ( p->vAbcObjIds)  Vec_IntFree( p->vAbcObjIds );
     if ( p->vCexVec   )  Vec_PtrFreeFree( p->vCexVec );
@@ -257,8 +262,11 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     ABC_FREE( p->pBoxes );
     
 
+    if ( p == s_PrivateFrame )
+        s_PrivateFrame = NULL;
+    else
+        s_MainFrame = NULL;
     ABC_FREE( p );
-    s_GlobalFrame = NULL;
 }
 
 
@@ -625,7 +633,7 @@ void Abc_FrameDeleteAllNetworks( Abc_Frame_t * p )
 ***********************************************************************/
 void Abc_FrameSetGlobalFrame( Abc_Frame_t * p )
 {
-    s_GlobalFrame = p;
+    s_MainFrame = p;
 }
 
 /**Function*************************************************************
@@ -641,14 +649,16 @@ void Abc_FrameSetGlobalFrame( Abc_Frame_t * p )
 ***********************************************************************/
 Abc_Frame_t * Abc_FrameGetGlobalFrame()
 {
-    if ( s_GlobalFrame == 0 )
+    if ( s_PrivateFrame )
+        return s_PrivateFrame;
+    if ( s_MainFrame == 0 )
     {
         // start the framework
-        s_GlobalFrame = Abc_FrameAllocate();
+        s_MainFrame = Abc_FrameAllocate();
         // perform initializations
-        Abc_FrameInit( s_GlobalFrame );
+        Abc_FrameInit( s_MainFrame );
     }
-    return s_GlobalFrame;
+    return s_MainFrame;
 }
 
 /**Function*************************************************************
@@ -667,6 +677,71 @@ Abc_Frame_t * Abc_FrameReadGlobalFrame()
     return s_GlobalFrame;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the private frame of the current thread.]
+
+  Description [The private frame shares the command, alias and flag tables
+  and the mapping libraries with the main frame, but has its own networks,
+  AIGs, counter-examples, etc. Until the private frame is stopped, the frame
+  APIs called by this thread (including Abc_FrameGetGlobalFrame) refer to it, 
+  so that several threads can execute command scripts using 
+  Cmd_CommandExecute() at the same time. The main frame should be started 
+  and should not be changed while the private frames are in use.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Frame_t * Abc_FrameStartPrivate()
+{
+    extern void Dar_LibStartPrivate();
+    Abc_Frame_t * pMain = Abc_FrameGetGlobalFrame(), * p;
+    assert( s_PrivateFrame == NULL );
+    p = Abc_FrameAllocate();
+    p->tCommands  = pMain->tCommands;
+    p->tAliases   = pMain->tAliases;
+    p->tFlags     = pMain->tFlags;
+    p->aHistory   = Vec_PtrAlloc( 100 );
+    p->pLibLut    = pMain->pLibLut;
+    p->pLibBox    = pMain->pLibBox;
+    p->pLibGen    = pMain->pLibGen;
+    p->pLibGen2   = pMain->pLibGen2;
+    p->pLibSuper  = pMain->pLibSuper;
+    p->pLibScl    = pMain->pLibScl;
+    p->fBatchMode = 1;
+    s_PrivateFrame = p;
+    Dar_LibStartPrivate();
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the private frame of the current thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameStopPrivate()
+{
+    extern void Dar_LibStopPrivate();
+    Abc_Frame_t * p = s_PrivateFrame;
+    assert( p != NULL );
+    Dar_LibStopPrivate();
+    // detach the data shared with the main frame
+    p->tCommands = p->tAliases = p->tFlags = NULL;
+    p->pLibLut   = p->pLibBox  = p->pLibGen = p->pLibGen2 = NULL;
+    p->pLibSuper = p->pLibScl  = NULL;
+    Vec_PtrFreeFree( p->aHistory );
+    Abc_FrameDeallocate( p );
+    assert( s_PrivateFrame == NULL );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -280,7 +280,7 @@ extern void                Pla_ManConvertFromBits( Pla_Man_t * p );
 extern void                Pla_ManConvertToBits( Pla_Man_t * p );
 extern int                 Pla_ManDist1NumTest( Pla_Man_t * p );
 /*=== plaMerge.c ========================================================*/
-extern int                 Pla_ManDist1Merge( Pla_Man_t * p );
+extern int                 Pla_ManDist1Merge( Pla_Man_t * p, int fMulti, int nThreads, int fVerbose );
 /*=== plaSimple.c ========================================================*/
 extern int                 Pla_ManFxPerformSimple( int nVars );
 /*=== plaRead.c ========================================================*/
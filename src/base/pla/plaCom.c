@@ -404,12 +404,23 @@ usage:
 int Abc_CommandMerge( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Pla_Man_t * p = Pla_AbcGetMan(pAbc);
-    int c, fMulti = 0, fVerbose  = 0;
+    int c, nThreads = 1, fMulti = 0, fVerbose  = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "mvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pmvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads <= 0 )
+                goto usage;
+            break;
         case 'm':
             fMulti ^= 1;
             break;
@@ -428,11 +439,13 @@ int Abc_CommandMerge( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 0;
     }
     // transform
-    Pla_ManDist1Merge( p );
+    Pla_ManDist1Merge( p, fMulti, nThreads, fVerbose );
     return 0;
 usage:
-    Abc_Print( -2, "usage: |merge [-mvh]\n" );
+    Abc_Print( -2, "usage: |merge [-P num] [-mvh]\n" );
     Abc_Print( -2, "\t         performs distance-1 merge using cube hashing\n" );
+    Abc_Print( -2, "\t-P num : the number of concurrent threads (one output per thread) [default = %d]\n", nThreads );
+    Abc_Print( -2, "\t-m     : toggle sharing identical cubes among the outputs [default = %s]\n", fMulti? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
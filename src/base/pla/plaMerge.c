@@ -20,19 +20,185 @@
 
 #include "pla.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define PLA_PAR_MAX       64     // the max number of threads
+#define PLA_SCC_LIMIT  20000     // the max number of cubes for containment check
+
+typedef struct Pla_MergePar_t_ Pla_MergePar_t;
+struct Pla_MergePar_t_
+{
+    Pla_Man_t *      pMan;       // the PLA (read-only)
+    Vec_Wrd_t **     pRes;       // minimized input cubes of each output
+    int              iNext;      // the next output to minimize
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;
+#endif
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Collects the input parts of the cubes in the on-set of the output.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t * Pla_ManCollectOnset( Pla_Man_t * p, int iOut )
+{
+    Vec_Wrd_t * vCubes = Vec_WrdAlloc( 100 );
+    word * pCubeIn, * pCubeOut; int i, k;
+    Pla_ForEachCubeInOut( p, pCubeIn, pCubeOut, i )
+        if ( Pla_CubeGetLit(pCubeOut, iOut) == PLA_LIT_ONE )
+            for ( k = 0; k < p->nInWords; k++ )
+                Vec_WrdPush( vCubes, pCubeIn[k] );
+    return vCubes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of greedy distance-1 merging.]
+
+  Description [Removes duplicated cubes and merges each cube with at most
+  one distance-1 partner found by hashing. Returns the number of merges.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pla_ManMergeRound( Vec_Wrd_t * vCubes, int nVars, int nWords )
+{
+    Vec_Mem_t * vTable = Vec_MemAlloc( nWords, 12 );
+    Vec_Wrd_t * vNew = Vec_WrdAlloc( Vec_WrdSize(vCubes) );
+    Vec_Str_t * vUsed;
+    word * pCube, * pTemp = ABC_ALLOC( word, nWords );
+    int i, v, k, Lit, * pSpot, nMerges = 0;
+    Vec_MemHashAlloc( vTable, Vec_WrdSize(vCubes) / nWords + 1 );
+    for ( i = 0; i < Vec_WrdSize(vCubes); i += nWords )
+        Vec_MemHashInsert( vTable, Vec_WrdEntryP(vCubes, i) );
+    vUsed = Vec_StrStart( Vec_MemEntryNum(vTable) );
+    Vec_MemForEachEntry( vTable, pCube, i )
+    {
+        if ( Vec_StrEntry(vUsed, i) )
+            continue;
+        Vec_StrWriteEntry( vUsed, i, 1 );
+        Pla_CubeForEachLit( nVars, pCube, Lit, v )
+        {
+            if ( Lit != PLA_LIT_ZERO && Lit != PLA_LIT_ONE )
+                continue;
+            // look for the cube with the opposite literal
+            memcpy( pTemp, pCube, sizeof(word) * nWords );
+            Pla_CubeXorLit( pTemp, v, PLA_LIT_FULL );
+            pSpot = Vec_MemHashLookup( vTable, pTemp );
+            if ( *pSpot == -1 || Vec_StrEntry(vUsed, *pSpot) )
+                continue;
+            Vec_StrWriteEntry( vUsed, *pSpot, 1 );
+            // replace both cubes by the one without this literal
+            Pla_CubeXorLit( pTemp, v, (Pla_Lit_t)(Lit ^ PLA_LIT_FULL) );
+            pCube = pTemp;
+            nMerges++;
+            break;
+        }
+        for ( k = 0; k < nWords; k++ )
+            Vec_WrdPush( vNew, pCube[k] );
+    }
+    Vec_WrdClear( vCubes );
+    Vec_WrdAppend( vCubes, vNew );
+    Vec_WrdFree( vNew );
+    Vec_StrFree( vUsed );
+    Vec_MemHashFree( vTable );
+    Vec_MemFree( vTable );
+    ABC_FREE( pTemp );
+    return nMerges;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the cubes contained in other cubes.]
+
+  Description [Cube A contains cube B if the literals of A are a subset 
+  of the literals of B, which is a bit-wise check in this encoding.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pla_ManRemoveContained( Vec_Wrd_t * vCubes, int nWords )
+{
+    Vec_Wrd_t * vNew;
+    Vec_Int_t * vLits, * vOrder;
+    int nCubes = Vec_WrdSize(vCubes) / nWords;
+    int i, j, k, iA, iB, nRemoved = 0;
+    if ( nCubes < 2 || nCubes > PLA_SCC_LIMIT )
+        return 0;
+    vLits = Vec_IntAlloc( nCubes );
+    for ( i = 0; i < nCubes; i++ )
+        Vec_IntPush( vLits, Pla_TtCountOnes(Vec_WrdEntryP(vCubes, i * nWords), nWords) );
+    // cubes with fewer literals come first and can only contain the following ones
+    vOrder = Vec_IntAlloc( nCubes );
+    for ( i = 0; i < nCubes; i++ )
+        Vec_IntPush( vOrder, i );
+    Vec_IntSelectSortCost( Vec_IntArray(vOrder), nCubes, vLits );
+    for ( j = 1; j < nCubes; j++ )
+    {
+        word * pB = Vec_WrdEntryP( vCubes, (iB = Vec_IntEntry(vOrder, j)) * nWords );
+        for ( i = 0; i < j; i++ )
+        {
+            word * pA = Vec_WrdEntryP( vCubes, (iA = Vec_IntEntry(vOrder, i)) * nWords );
+            if ( Vec_IntEntry(vLits, iA) == -1 || Vec_IntEntry(vLits, iA) == Vec_IntEntry(vLits, iB) )
+                continue;
+            for ( k = 0; k < nWords; k++ )
+                if ( pA[k] & ~pB[k] )
+                    break;
+            if ( k == nWords )
+                break;
+        }
+        if ( i < j )
+            Vec_IntWriteEntry( vLits, iB, -1 ), nRemoved++;
+    }
+    if ( nRemoved )
+    {
+        vNew = Vec_WrdAlloc( Vec_WrdSize(vCubes) );
+        for ( i = 0; i < nCubes; i++ )
+            if ( Vec_IntEntry(vLits, i) != -1 )
+                for ( k = 0; k < nWords; k++ )
+                    Vec_WrdPush( vNew, Vec_WrdEntry(vCubes, i * nWords + k) );
+        Vec_WrdClear( vCubes );
+        Vec_WrdAppend( vCubes, vNew );
+        Vec_WrdFree( vNew );
+    }
+    Vec_IntFree( vLits );
+    Vec_IntFree( vOrder );
+    return nRemoved;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Minimizes the on-set of one output.]
 
   Description []
                
@@ -41,9 +207,172 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
-int Pla_ManDist1Merge( Pla_Man_t * p )
+Vec_Wrd_t * Pla_ManMergeOutput( Pla_Man_t * p, int iOut )
+{
+    Vec_Wrd_t * vCubes = Pla_ManCollectOnset( p, iOut );
+    if ( Vec_WrdSize(vCubes) == 0 )
+        return vCubes;
+    while ( Pla_ManMergeRound( vCubes, p->nIns, p->nInWords ) );
+    Pla_ManRemoveContained( vCubes, p->nInWords );
+    return vCubes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Minimizes the outputs concurrently.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void * Pla_ManMergeThread( void * pArg )
+{
+    Pla_MergePar_t * p = (Pla_MergePar_t *)pArg;
+    while ( 1 )
+    {
+        int iOut;
+        pthread_mutex_lock( &p->Mutex );
+        iOut = p->iNext++;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iOut >= Pla_ManOutNum(p->pMan) )
+            break;
+        p->pRes[iOut] = Pla_ManMergeOutput( p->pMan, iOut );
+    }
+    return NULL;
+}
+#endif
+void Pla_ManMergeOutputs( Pla_Man_t * p, Vec_Wrd_t ** pRes, int nThreads )
+{
+    Pla_MergePar_t Par;
+    int i;
+    Par.pMan  = p;
+    Par.pRes  = pRes;
+    Par.iNext = 0;
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 && Pla_ManOutNum(p) > 1 )
+    {
+        pthread_t WorkerThread[PLA_PAR_MAX];
+        int status, nWorkers = Abc_MinInt( Abc_MinInt(nThreads, PLA_PAR_MAX), Pla_ManOutNum(p) );
+        pthread_mutex_init( &Par.Mutex, NULL );
+        for ( i = 0; i < nWorkers; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Pla_ManMergeThread, (void *)&Par );
+            assert( status == 0 );
+        }
+        for ( i = 0; i < nWorkers; i++ )
+            pthread_join( WorkerThread[i], NULL );
+        pthread_mutex_destroy( &Par.Mutex );
+        return;
+    }
+#endif
+    for ( i = 0; i < Pla_ManOutNum(p); i++ )
+        pRes[i] = Pla_ManMergeOutput( p, i );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the cubes of the PLA by the minimized ones.]
+
+  Description [If fMulti is set, identical input cubes of different 
+  outputs are shared by one multi-output cube. Only the on-set is kept,
+  so the off-set and the DC-set of the original PLA are dropped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pla_ManMergeUpdate( Pla_Man_t * p, Vec_Wrd_t ** pRes, int fMulti )
+{
+    Vec_Mem_t * vTable = Vec_MemAlloc( p->nInWords, 12 );
+    Vec_Wrd_t * vOutBits = Vec_WrdAlloc( 1000 );
+    word * pCube, * pCubeOut;
+    int i, o, k, iCube, nCubes = 0, nDcs = 0;
+    // only the on-set is kept; warn if the off-set or the DC-set is dropped
+    if ( p->Type == PLA_FILE_FD || p->Type == PLA_FILE_FDR )
+        Pla_ForEachCubeInOut( p, pCube, pCubeOut, i )
+            for ( o = 0; o < p->nOuts; o++ )
+                nDcs += (Pla_CubeGetLit(pCubeOut, o) == PLA_LIT_DASH);
+    if ( p->Type == PLA_FILE_FR || p->Type == PLA_FILE_FDR )
+        printf( "Warning: The off-set of the PLA (type %s) is dropped.\n", p->Type == PLA_FILE_FR ? "fr" : "fdr" );
+    if ( nDcs )
+        printf( "Warning: The don't-care set of the PLA (%d output literals) is dropped.\n", nDcs );
+    for ( o = 0; o < Pla_ManOutNum(p); o++ )
+        nCubes += Vec_WrdSize(pRes[o]) / p->nInWords;
+    if ( fMulti )
+        Vec_MemHashAlloc( vTable, nCubes + 1 );
+    for ( o = 0; o < Pla_ManOutNum(p); o++ )
+    for ( i = 0; i < Vec_WrdSize(pRes[o]); i += p->nInWords )
+    {
+        pCube = Vec_WrdEntryP( pRes[o], i );
+        if ( fMulti )
+            iCube = Vec_MemHashInsert( vTable, pCube );
+        else
+            Vec_MemPush( vTable, pCube ), iCube = Vec_MemEntryNum(vTable) - 1;
+        if ( iCube * p->nOutWords == Vec_WrdSize(vOutBits) )
+        {
+            Vec_WrdFillExtra( vOutBits, (iCube + 1) * p->nOutWords, 0 );
+            pCubeOut = Vec_WrdEntryP( vOutBits, iCube * p->nOutWords );
+            for ( k = 0; k < p->nOuts; k++ )
+                Pla_CubeSetLit( pCubeOut, k, PLA_LIT_ZERO );
+        }
+        pCubeOut = Vec_WrdEntryP( vOutBits, iCube * p->nOutWords );
+        Pla_CubeXorLit( pCubeOut, o, PLA_LIT_FULL );
+    }
+    // update the manager
+    nCubes = Vec_MemEntryNum( vTable );
+    Vec_IntFillNatural( &p->vCubes, nCubes );
+    Vec_WrdClear( &p->vInBits );
+    Vec_MemForEachEntry( vTable, pCube, i )
+        for ( k = 0; k < p->nInWords; k++ )
+            Vec_WrdPush( &p->vInBits, pCube[k] );
+    Vec_WrdClear( &p->vOutBits );
+    Vec_WrdAppend( &p->vOutBits, vOutBits );
+    Vec_IntErase( &p->vHashes );
+    Vec_WecErase( &p->vCubeLits );
+    Vec_WecErase( &p->vOccurs );
+    // only the on-set is written now
+    if ( p->Type != PLA_FILE_F )
+        p->Type = PLA_FILE_FD;
+    Vec_WrdFree( vOutBits );
+    Vec_MemHashFree( vTable );
+    Vec_MemFree( vTable );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Two-level minimization by distance-1 merging.]
+
+  Description [The on-set of each output is minimized independently, 
+  which allows for processing the outputs concurrently using nThreads 
+  threads. The result does not depend on the number of threads.
+  Returns the number of cubes after minimization.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pla_ManDist1Merge( Pla_Man_t * p, int fMulti, int nThreads, int fVerbose )
 {
-    return 0;
+    abctime clk = Abc_Clock();
+    Vec_Wrd_t ** pRes = ABC_CALLOC( Vec_Wrd_t *, Pla_ManOutNum(p) );
+    int o, nCubes = Pla_ManCubeNum(p);
+    Pla_ManMergeOutputs( p, pRes, nThreads );
+    Pla_ManMergeUpdate( p, pRes, fMulti );
+    for ( o = 0; o < Pla_ManOutNum(p); o++ )
+        Vec_WrdFree( pRes[o] );
+    ABC_FREE( pRes );
+    if ( fVerbose )
+    {
+        printf( "Cubes: %d -> %d.  Threads = %d.  ", nCubes, Pla_ManCubeNum(p), nThreads );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return Pla_ManCubeNum(p);
 }
 
 ////////////////////////////////////////////////////////////////////////
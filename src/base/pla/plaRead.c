@@ -32,186 +32,190 @@ ABC_NAMESPACE_IMPL_START
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Reads the PLA file in fixed-size chunks.]
 
-  Description []
+  Description [Keeps only one chunk of the file in memory and writes 
+  literals directly into the cube bit-strings. The header (.i/.o/.type) 
+  should precede the first cube.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-char * Pla_ReadFile( char * pFileName, char ** ppLimit )
+#define PLA_READ_CHUNK (1 << 16)
+
+int Pla_ReadPlaDirective( char * pLine, int * pnIns, int * pnOuts, int * pnCubes, int * pType )
 {
-    char * pBuffer;
-    int nFileSize, RetValue;
-    FILE * pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
+    if ( !strncmp(pLine, ".i ", 3) )
+        *pnIns = atoi( pLine + 3 );
+    else if ( !strncmp(pLine, ".o ", 3) )
+        *pnOuts = atoi( pLine + 3 );
+    else if ( !strncmp(pLine, ".p ", 3) )
+        *pnCubes = atoi( pLine + 3 );
+    else if ( !strncmp(pLine, ".e", 2) && (pLine[2] == 0 || pLine[2] == ' ' || pLine[2] == '\r') )
+        return 1;
+    else if ( !strncmp(pLine, ".type ", 6) )
     {
-        printf( "Cannot open input file.\n" );
-        return NULL;
+        char Buffer[100];
+        *pType = PLA_FILE_NONE;
+        if ( sscanf( pLine+6, "%99s", Buffer ) != 1 )
+            return 0;
+        if ( !strcmp(Buffer, "f") )
+            *pType = PLA_FILE_F;
+        else if ( !strcmp(Buffer, "fr") )
+            *pType = PLA_FILE_FR;
+        else if ( !strcmp(Buffer, "fd") )
+            *pType = PLA_FILE_FD;
+        else if ( !strcmp(Buffer, "fdr") )
+            *pType = PLA_FILE_FDR;
     }
-    // get the file size, in bytes
-    fseek( pFile, 0, SEEK_END );  
-    nFileSize = ftell( pFile );  
-    // move the file current reading position to the beginning
-    rewind( pFile ); 
-    // load the contents of the file into memory
-    pBuffer = ABC_ALLOC( char, nFileSize + 16 );
-    pBuffer[0] = '\n';
-    RetValue = fread( pBuffer+1, nFileSize, 1, pFile );
-    fclose( pFile );
-    // terminate the string with '\0'
-    pBuffer[nFileSize + 1] = '\n';
-    pBuffer[nFileSize + 2] = '\0';
-    *ppLimit = pBuffer + nFileSize + 3;
-    return pBuffer;
+    return 0;
 }
-
-/**Function*************************************************************
-
-  Synopsis    []
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-void Pla_ReadPlaRemoveComments( char * pBuffer, char * pLimit )
+static inline int Pla_ReadPlaLit( char c, Pla_File_t Type )
 {
-    char * pTemp; 
-    for ( pTemp = pBuffer; pTemp < pLimit; pTemp++ )
-        if ( *pTemp == '#' )
-            while ( *pTemp && *pTemp != '\n' )
-                *pTemp++ = ' ';
-}
-int Pla_ReadPlaHeader( char * pBuffer, char * pLimit, int * pnIns, int * pnOuts, int * pnCubes, int * pType )
-{
-    char * pTemp; 
-    *pType = PLA_FILE_FD;
-    *pnIns = *pnOuts = *pnCubes = -1;
-    for ( pTemp = pBuffer; pTemp < pLimit; pTemp++ )
+    if ( c == '0' )
+        return PLA_LIT_ZERO;
+    if ( c == '1' )
+        return PLA_LIT_ONE;
+    if ( c == '-' || c == '2' )
+        return PLA_LIT_DASH;
+    if ( c == '~' ) // no meaning
     {
-        if ( *pTemp != '.' )
-            continue;
-        if ( !strncmp(pTemp, ".i ", 3) )
-            *pnIns = atoi( pTemp + 3 );
-        else if ( !strncmp(pTemp, ".o ", 3) )
-            *pnOuts = atoi( pTemp + 3 );
-        else if ( !strncmp(pTemp, ".p ", 3) )
-            *pnCubes = atoi( pTemp + 3 );
-        else if ( !strncmp(pTemp, ".e ", 3) )
-            break;
-        else if ( !strncmp(pTemp, ".type ", 6) )
-        {
-            char Buffer[100];
-            *pType = PLA_FILE_NONE;
-            sscanf( pTemp+6, "%s", Buffer );
-            if ( !strcmp(Buffer, "f") )
-                *pType = PLA_FILE_F;
-            else if ( !strcmp(Buffer, "fr") )
-                *pType = PLA_FILE_FR;
-            else if ( !strcmp(Buffer, "fd") )
-                *pType = PLA_FILE_FD;
-            else if ( !strcmp(Buffer, "fdr") )
-                *pType = PLA_FILE_FDR;
-        }
+        if ( Type == PLA_FILE_F || Type == PLA_FILE_FD )
+            return PLA_LIT_ZERO;
+        if ( Type == PLA_FILE_FR )
+            return PLA_LIT_DASH;
+        if ( Type == PLA_FILE_FDR )
+            return PLA_LIT_FULL;
+        assert( 0 );
     }
-    if ( *pnIns <= 0 )
-        printf( "The number of inputs (.i) should be positive.\n" );
-    if ( *pnOuts <= 0 )
-        printf( "The number of outputs (.o) should be positive.\n" );
-    return *pnIns > 0 && *pnOuts > 0;
+    return -1;
 }
-Vec_Str_t * Pla_ReadPlaBody( char * pBuffer, char * pLimit, Pla_File_t Type )
+Pla_Man_t * Pla_ReadPla( char * pFileName )
 {
-    char * pTemp;
-    Vec_Str_t * vLits;
-    vLits = Vec_StrAlloc( 10000 );
-    for ( pTemp = pBuffer; pTemp < pLimit; pTemp++ )
+    Pla_Man_t * p = NULL;
+    Vec_Str_t * vLine = Vec_StrAlloc( 1000 );
+    char * pBuffer = ABC_ALLOC( char, PLA_READ_CHUNK );
+    int nIns = -1, nOuts = -1, nCubes = -1, Type = PLA_FILE_FD;
+    int fComment = 0, fDirective = 0, fDone = 0, fError = 0;
+    int i, nRead, Lit, iLit = 0, nCubesReal = 0;
+    word * pCube = NULL;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
     {
-        if ( *pTemp == '.' )
-            while ( *pTemp && *pTemp != '\n' )
-                pTemp++;
-        if ( *pTemp == '0' )
-            Vec_StrPush( vLits, (char)PLA_LIT_ZERO );
-        else if ( *pTemp == '1' )
-            Vec_StrPush( vLits, (char)PLA_LIT_ONE );
-        else if ( *pTemp == '-' || *pTemp == '2' )
-            Vec_StrPush( vLits, (char)PLA_LIT_DASH );
-        else if ( *pTemp == '~' ) // no meaning
-        {
-            if ( Type == PLA_FILE_F || Type == PLA_FILE_FD )
-                Vec_StrPush( vLits, (char)PLA_LIT_ZERO );
-            else if ( Type == PLA_FILE_FR )
-                Vec_StrPush( vLits, (char)PLA_LIT_DASH );
-            else if ( Type == PLA_FILE_FDR )
-                Vec_StrPush( vLits, (char)PLA_LIT_FULL );
-            else assert( 0 );
-        }
+        printf( "Cannot open input file.\n" );
+        Vec_StrFree( vLine );
+        ABC_FREE( pBuffer );
+        return NULL;
     }
-    return vLits;
-}
-void Pla_ReadAddBody( Pla_Man_t * p, Vec_Str_t * vLits )
-{
-    word * pCubeIn, * pCubeOut; 
-    int i, k, Lit, Count = 0; 
-    int nCubesReal = Vec_StrSize(vLits) / (p->nIns + p->nOuts);
-    assert( Vec_StrSize(vLits) % (p->nIns + p->nOuts) == 0 );
-    if ( nCubesReal != Pla_ManCubeNum(p) )
+    while ( !fDone && !fError && (nRead = (int)fread( pBuffer, 1, PLA_READ_CHUNK, pFile )) > 0 )
     {
-        printf( "Warning: Declared number of cubes (%d) differs from the actual (%d).\n", 
-            Pla_ManCubeNum(p), nCubesReal );
-        if ( nCubesReal < Pla_ManCubeNum(p) )
-            Vec_IntShrink( &p->vCubes, nCubesReal );
-        else
+        for ( i = 0; i < nRead && !fDone && !fError; i++ )
         {
-            assert( nCubesReal > Pla_ManCubeNum(p) );
-            Vec_IntFillNatural( &p->vCubes, nCubesReal );
-            Vec_WrdFillExtra( &p->vInBits,  nCubesReal * p->nInWords,  0 );
-            Vec_WrdFillExtra( &p->vOutBits, nCubesReal * p->nOutWords, 0 );
+            char c = pBuffer[i];
+            if ( c == '\n' )
+            {
+                if ( fDirective )
+                {
+                    Vec_StrPush( vLine, '\0' );
+                    fDone = Pla_ReadPlaDirective( Vec_StrArray(vLine), &nIns, &nOuts, &nCubes, &Type );
+                }
+                fComment = fDirective = 0;
+                continue;
+            }
+            if ( fComment )
+                continue;
+            if ( c == '#' )
+            {
+                fComment = 1;
+                continue;
+            }
+            if ( fDirective )
+            {
+                Vec_StrPush( vLine, c );
+                continue;
+            }
+            if ( c == '.' )
+            {
+                Vec_StrClear( vLine );
+                Vec_StrPush( vLine, c );
+                fDirective = 1;
+                continue;
+            }
+            if ( (Lit = Pla_ReadPlaLit(c, (Pla_File_t)Type)) == -1 )
+                continue;
+            if ( p == NULL )
+            {
+                if ( nIns <= 0 || nOuts <= 0 )
+                {
+                    printf( "The header (.i and .o) should precede the first cube.\n" );
+                    fError = 1;
+                    break;
+                }
+                p = Pla_ManAlloc( pFileName, nIns, nOuts, 0 );
+                p->Type = (Pla_File_t)Type;
+                if ( nCubes > 0 )
+                {
+                    Vec_IntGrow( &p->vCubes, nCubes );
+                    Vec_WrdGrow( &p->vInBits,  nCubes * p->nInWords );
+                    Vec_WrdGrow( &p->vOutBits, nCubes * p->nOutWords );
+                }
+            }
+            // start a new cube
+            if ( iLit == 0 )
+            {
+                Vec_IntPush( &p->vCubes, nCubesReal++ );
+                Vec_WrdFillExtra( &p->vInBits,  nCubesReal * p->nInWords,  0 );
+                Vec_WrdFillExtra( &p->vOutBits, nCubesReal * p->nOutWords, 0 );
+            }
+            if ( iLit < nIns )
+            {
+                pCube = Pla_CubeIn( p, nCubesReal-1 );
+                Pla_CubeSetLit( pCube, iLit, (Pla_Lit_t)Lit );
+            }
+            else
+            {
+                pCube = Pla_CubeOut( p, nCubesReal-1 );
+                Pla_CubeSetLit( pCube, iLit - nIns, (Pla_Lit_t)Lit );
+            }
+            if ( ++iLit == nIns + nOuts )
+                iLit = 0;
         }
     }
-    Pla_ForEachCubeInOut( p, pCubeIn, pCubeOut, i )
+    if ( !fError && fDirective && !fDone ) // last line without the new-line character
     {
-        Pla_CubeForEachLit( p->nIns, pCubeIn, Lit, k )
-            Pla_CubeSetLit( pCubeIn, k, (Pla_Lit_t)Vec_StrEntry(vLits, Count++) );
-        Pla_CubeForEachLit( p->nOuts, pCubeOut, Lit, k )
-            Pla_CubeSetLit( pCubeOut, k, (Pla_Lit_t)Vec_StrEntry(vLits, Count++) );
+        Vec_StrPush( vLine, '\0' );
+        Pla_ReadPlaDirective( Vec_StrArray(vLine), &nIns, &nOuts, &nCubes, &Type );
     }
-    assert( Count == Vec_StrSize(vLits) );
-}
-Pla_Man_t * Pla_ReadPla( char * pFileName )
-{   
-    Pla_Man_t * p;
-    Vec_Str_t * vLits;
-    int nIns, nOuts, nCubes, Type;
-    char * pBuffer, * pLimit;   
-    pBuffer = Pla_ReadFile( pFileName, &pLimit );
-    if ( pBuffer == NULL )
+    fclose( pFile );
+    Vec_StrFree( vLine );
+    ABC_FREE( pBuffer );
+    if ( fError )
+    {
+        if ( p ) Pla_ManFree( p );
         return NULL;
-    Pla_ReadPlaRemoveComments( pBuffer, pLimit );
-    if ( Pla_ReadPlaHeader( pBuffer, pLimit, &nIns, &nOuts, &nCubes, &Type ) )
+    }
+    if ( p == NULL )
     {
-        vLits = Pla_ReadPlaBody( pBuffer, pLimit, (Pla_File_t)Type );
-        if ( Vec_StrSize(vLits) % (nIns + nOuts) == 0 )
-        {
-            if ( nCubes == -1 )
-                nCubes = Vec_StrSize(vLits) / (nIns + nOuts);
-            p = Pla_ManAlloc( pFileName, nIns, nOuts, nCubes );
-            p->Type = (Pla_File_t)Type;
-            Pla_ReadAddBody( p, vLits );
-            Vec_StrFree( vLits );
-            ABC_FREE( pBuffer );
-            return p;
-        }
-        printf( "Literal count is incorrect (in = %d; out = %d; lit = %d).\n", nIns, nOuts, Vec_StrSize(vLits) );
-        Vec_StrFree( vLits );
+        if ( nIns <= 0 )
+            printf( "The number of inputs (.i) should be positive.\n" );
+        if ( nOuts <= 0 )
+            printf( "The number of outputs (.o) should be positive.\n" );
+        if ( nIns <= 0 || nOuts <= 0 )
+            return NULL;
+        p = Pla_ManAlloc( pFileName, nIns, nOuts, 0 );
+        p->Type = (Pla_File_t)Type;
     }
-    ABC_FREE( pBuffer );
-    return NULL;
+    if ( iLit != 0 )
+    {
+        printf( "Literal count is incorrect (in = %d; out = %d; lit = %d).\n", nIns, nOuts, (nCubesReal-1) * (nIns + nOuts) + iLit );
+        Pla_ManFree( p );
+        return NULL;
+    }
+    if ( nCubes != -1 && nCubes != nCubesReal )
+        printf( "Warning: Declared number of cubes (%d) differs from the actual (%d).\n", nCubes, nCubesReal );
+    return p;
 }
 
 
@@ -294,6 +294,20 @@ int Aig_ManComputeReachable( DdManager * dd, Aig_Man_t * p, DdNode ** pbParts, D
             pPars->iFrame = nIters - 1;
             return -1;
         }
+        // check the external stop request
+        if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+        {
+            if ( !pPars->fSilent )
+                printf( "Reachability analysis was cancelled after %d iterations.\n", nIters );
+            Vec_PtrFree( vOnionRings );
+            // undo the image tree
+            if ( pPars->fPartition )
+                Bbr_bddImageTreeDelete( pTree );
+            else
+                Bbr_bddImageTreeDelete2( pTree2 );
+            pPars->iFrame = nIters - 1;
+            return -1;
+        }
 
         // compute the next states
         if ( pPars->fPartition )
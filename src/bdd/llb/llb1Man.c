@@ -145,6 +145,10 @@ void Llb_ManStop( Llb_Man_t * p )
     if ( p->dd )
     {
 //        printf( "Manager dd\n" );
+        if ( p->vClusters )
+            Vec_PtrForEachEntry( DdNode *, p->vClusters, bTemp, i )
+                if ( bTemp )
+                    Cudd_RecursiveDeref( p->dd, bTemp );
         Extra_StopManager( p->dd );
     }
     if ( p->ddG )
@@ -170,6 +174,8 @@ void Llb_ManStop( Llb_Man_t * p )
     Vec_IntFreeP( &p->vVarBegs );
     Vec_IntFreeP( &p->vVarEnds );
     Vec_PtrFreeP( &p->vRings  );
+    Vec_PtrFreeP( &p->vObjBdds );
+    Vec_PtrFreeP( &p->vClusters );
     Vec_IntFreeP( &p->vNs2Glo );
     Vec_IntFreeP( &p->vCs2Glo );
     Vec_IntFreeP( &p->vGlo2Cs );
@@ -201,6 +207,7 @@ Llb_Man_t * Llb_ManStart( Aig_Man_t * pAigGlo, Aig_Man_t * pAig, Gia_ParLlb_t *
     p->vVar2Obj = Llb_ManMarkPivotNodes( p->pAig, pPars->fUsePivots );
     p->vObj2Var = Vec_IntInvert( p->vVar2Obj, -1 );
     p->vRings   = Vec_PtrAlloc( 100 );
+    p->vObjBdds = Vec_PtrStart( Aig_ManObjNumMax(pAig) );
     Llb_ManPrepareVarMap( p );
     Llb_ManPrepareGroups( p );
     Aig_ManCleanMarkA( pAig );
@@ -20,6 +20,17 @@
 
 #include "llbInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
  
@@ -27,6 +38,20 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define LLB_PAR_MAX 64
+
+// information given to the thread building one cluster
+typedef struct Llb_ThData_t_
+{
+    Llb_Man_t *   p;            // the reachability manager (read-only)
+    DdManager *   dd;           // the manager of this thread
+    DdNode **     pBdds;        // the BDDs of the AIG objects in this manager
+    Llb_Grp_t *   pGroup;       // the cluster to build
+    int           Index;        // the place of the cluster in the schedule
+    int           fBackward;    // the direction of the image
+    DdNode *      bRes;         // the resulting cluster BDD in this manager
+} Llb_ThData_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -79,68 +104,87 @@ DdNode * Llb_ManConstructOutBdd( Aig_Man_t * pAig, Aig_Obj_t * pNode, DdManager
 
 /**Function*************************************************************
 
-  Synopsis    [Derives BDD for the group.]
+  Synopsis    [Derives BDD for the group in the given manager.]
 
-  Description []
+  Description [Same as Llb_ManConstructGroupBdd() but keeps the BDDs of
+  the AIG objects in the array, so that several threads can build
+  different groups of the same AIG at the same time.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-DdNode * Llb_ManConstructGroupBdd( Llb_Man_t * p, Llb_Grp_t * pGroup )
+DdNode * Llb_ManConstructGroupBddInt( Llb_Man_t * p, DdManager * dd, Llb_Grp_t * pGroup, DdNode ** pBdds )
 {
     Aig_Obj_t * pObj;
     DdNode * bBdd0, * bBdd1, * bRes, * bXor, * bTemp;
     int i, k;
-    Aig_ManConst1(p->pAig)->pData = Cudd_ReadOne( p->dd );
+    pBdds[Aig_ObjId(Aig_ManConst1(p->pAig))] = Cudd_ReadOne( dd );
     Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vIns, pObj, i )
-        pObj->pData = Cudd_bddIthVar( p->dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj)) );
+        pBdds[Aig_ObjId(pObj)] = Cudd_bddIthVar( dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj)) );
     Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vNodes, pObj, i )
     {
-        bBdd0 = Cudd_NotCond( Aig_ObjFanin0(pObj)->pData, Aig_ObjFaninC0(pObj) );
-        bBdd1 = Cudd_NotCond( Aig_ObjFanin1(pObj)->pData, Aig_ObjFaninC1(pObj) );
-//        pObj->pData = Extra_bddAndTime( p->dd, bBdd0, bBdd1, p->pPars->TimeTarget );  
-        pObj->pData = Cudd_bddAnd( p->dd, bBdd0, bBdd1 );  
-        if ( pObj->pData == NULL )
+        bBdd0 = Cudd_NotCond( pBdds[Aig_ObjFaninId0(pObj)], Aig_ObjFaninC0(pObj) );
+        bBdd1 = Cudd_NotCond( pBdds[Aig_ObjFaninId1(pObj)], Aig_ObjFaninC1(pObj) );
+//        pBdds[Aig_ObjId(pObj)] = Extra_bddAndTime( dd, bBdd0, bBdd1, p->pPars->TimeTarget );  
+        pBdds[Aig_ObjId(pObj)] = Cudd_bddAnd( dd, bBdd0, bBdd1 );  
+        if ( pBdds[Aig_ObjId(pObj)] == NULL )
         {
             Vec_PtrForEachEntryStop( Aig_Obj_t *, pGroup->vNodes, pObj, k, i )
-                if ( pObj->pData )
-                    Cudd_RecursiveDeref( p->dd, (DdNode *)pObj->pData );
+                if ( pBdds[Aig_ObjId(pObj)] )
+                    Cudd_RecursiveDeref( dd, pBdds[Aig_ObjId(pObj)] );
             return NULL;
         }
-        Cudd_Ref( (DdNode *)pObj->pData );
+        Cudd_Ref( pBdds[Aig_ObjId(pObj)] );
     }
-    bRes = Cudd_ReadOne( p->dd );   Cudd_Ref( bRes );
+    bRes = Cudd_ReadOne( dd );   Cudd_Ref( bRes );
     Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vOuts, pObj, i )
     {
         if ( Aig_ObjIsCo(pObj) )
-            bBdd0 = Cudd_NotCond( Aig_ObjFanin0(pObj)->pData, Aig_ObjFaninC0(pObj) );
+            bBdd0 = Cudd_NotCond( pBdds[Aig_ObjFaninId0(pObj)], Aig_ObjFaninC0(pObj) );
         else
-            bBdd0 = (DdNode *)pObj->pData;
-        bBdd1 = Cudd_bddIthVar( p->dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj)) );
-        bXor  = Cudd_bddXor( p->dd, bBdd0, bBdd1 );                  Cudd_Ref( bXor );
-//        bRes  = Extra_bddAndTime( p->dd, bTemp = bRes, Cudd_Not(bXor), p->pPars->TimeTarget );  
-        bRes  = Cudd_bddAnd( p->dd, bTemp = bRes, Cudd_Not(bXor) );  
+            bBdd0 = pBdds[Aig_ObjId(pObj)];
+        bBdd1 = Cudd_bddIthVar( dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj)) );
+        bXor  = Cudd_bddXor( dd, bBdd0, bBdd1 );                  Cudd_Ref( bXor );
+//        bRes  = Extra_bddAndTime( dd, bTemp = bRes, Cudd_Not(bXor), p->pPars->TimeTarget );  
+        bRes  = Cudd_bddAnd( dd, bTemp = bRes, Cudd_Not(bXor) );  
         if ( bRes == NULL )
         {
-            Cudd_RecursiveDeref( p->dd, bTemp );
-            Cudd_RecursiveDeref( p->dd, bXor );
+            Cudd_RecursiveDeref( dd, bTemp );
+            Cudd_RecursiveDeref( dd, bXor );
             Vec_PtrForEachEntryStop( Aig_Obj_t *, pGroup->vNodes, pObj, k, i )
-                if ( pObj->pData )
-                    Cudd_RecursiveDeref( p->dd, (DdNode *)pObj->pData );
+                if ( pBdds[Aig_ObjId(pObj)] )
+                    Cudd_RecursiveDeref( dd, pBdds[Aig_ObjId(pObj)] );
             return NULL;
         }        
         Cudd_Ref( bRes );
-        Cudd_RecursiveDeref( p->dd, bTemp );
-        Cudd_RecursiveDeref( p->dd, bXor );
+        Cudd_RecursiveDeref( dd, bTemp );
+        Cudd_RecursiveDeref( dd, bXor );
     }
     Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vNodes, pObj, i )
-        Cudd_RecursiveDeref( p->dd, (DdNode *)pObj->pData );
+        Cudd_RecursiveDeref( dd, pBdds[Aig_ObjId(pObj)] );
     Cudd_Deref( bRes );
     return bRes;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives BDD for the group.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_ManConstructGroupBdd( Llb_Man_t * p, Llb_Grp_t * pGroup )
+{
+    return Llb_ManConstructGroupBddInt( p, p->dd, pGroup, (DdNode **)Vec_PtrArray(p->vObjBdds) );
+}
+
+
 /**Function*************************************************************
 
   Synopsis    [Derives quantification cube.]
@@ -152,14 +196,14 @@ DdNode * Llb_ManConstructGroupBdd( Llb_Man_t * p, Llb_Grp_t * pGroup )
   SeeAlso     []
 
 ***********************************************************************/
-DdNode * Llb_ManConstructQuantCubeIntern( Llb_Man_t * p, Llb_Grp_t * pGroup, int iGrpPlace, int fBackward )
+DdNode * Llb_ManConstructQuantCubeInternInt( Llb_Man_t * p, DdManager * dd, Llb_Grp_t * pGroup, int iGrpPlace, int fBackward )
 {
     Aig_Obj_t * pObj;
     DdNode * bRes, * bTemp, * bVar;
     int i, iGroupFirst, iGroupLast;
     abctime TimeStop;
-    TimeStop = p->dd->TimeStop; p->dd->TimeStop = 0;
-    bRes = Cudd_ReadOne( p->dd );   Cudd_Ref( bRes );
+    TimeStop = dd->TimeStop; dd->TimeStop = 0;
+    bRes = Cudd_ReadOne( dd );   Cudd_Ref( bRes );
     Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vIns, pObj, i )
     {
         if ( fBackward && Saig_ObjIsPi(p->pAig, pObj) )
@@ -169,9 +213,9 @@ DdNode * Llb_ManConstructQuantCubeIntern( Llb_Man_t * p, Llb_Grp_t * pGroup, int
         assert( iGroupFirst <= iGroupLast );
         if ( iGroupFirst < iGroupLast )
             continue;
-        bVar  = Cudd_bddIthVar( p->dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj)) );
-        bRes  = Cudd_bddAnd( p->dd, bTemp = bRes, bVar );  Cudd_Ref( bRes );
-        Cudd_RecursiveDeref( p->dd, bTemp );
+        bVar  = Cudd_bddIthVar( dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj)) );
+        bRes  = Cudd_bddAnd( dd, bTemp = bRes, bVar );  Cudd_Ref( bRes );
+        Cudd_RecursiveDeref( dd, bTemp );
     }
     Vec_PtrForEachEntry( Aig_Obj_t *, pGroup->vOuts, pObj, i )
     {
@@ -182,14 +226,18 @@ DdNode * Llb_ManConstructQuantCubeIntern( Llb_Man_t * p, Llb_Grp_t * pGroup, int
         assert( iGroupFirst <= iGroupLast );
         if ( iGroupFirst < iGroupLast )
             continue;
-        bVar  = Cudd_bddIthVar( p->dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj)) );
-        bRes  = Cudd_bddAnd( p->dd, bTemp = bRes, bVar );  Cudd_Ref( bRes );
-        Cudd_RecursiveDeref( p->dd, bTemp );
+        bVar  = Cudd_bddIthVar( dd, Vec_IntEntry(p->vObj2Var, Aig_ObjId(pObj)) );
+        bRes  = Cudd_bddAnd( dd, bTemp = bRes, bVar );  Cudd_Ref( bRes );
+        Cudd_RecursiveDeref( dd, bTemp );
     }
     Cudd_Deref( bRes );
-    p->dd->TimeStop = TimeStop;
+    dd->TimeStop = TimeStop;
     return bRes;
 }
+DdNode * Llb_ManConstructQuantCubeIntern( Llb_Man_t * p, Llb_Grp_t * pGroup, int iGrpPlace, int fBackward )
+{
+    return Llb_ManConstructQuantCubeInternInt( p, p->dd, pGroup, iGrpPlace, fBackward );
+}
 
 /**Function*************************************************************
 
@@ -314,6 +362,198 @@ DdNode * Llb_ManComputeInitState( Llb_Man_t * p, DdManager * dd )
     return bRes;
 }
 
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Builds one cluster and quantifies its internal variables.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Llb_ManClusterThread( void * pArg )
+{
+    Llb_ThData_t * pThData = (Llb_ThData_t *)pArg;
+    DdNode * bGroup, * bCube, * bTemp;
+    pThData->bRes = NULL;
+    bGroup = Llb_ManConstructGroupBddInt( pThData->p, pThData->dd, pThData->pGroup, pThData->pBdds );
+    if ( bGroup == NULL )
+        return NULL;
+    Cudd_Ref( bGroup );
+    bCube  = Llb_ManConstructQuantCubeInternInt( pThData->p, pThData->dd, pThData->pGroup, pThData->Index, pThData->fBackward );  Cudd_Ref( bCube );
+    bGroup = Cudd_bddExistAbstract( pThData->dd, bTemp = bGroup, bCube );
+    if ( bGroup != NULL )
+        Cudd_Ref( bGroup );
+    Cudd_RecursiveDeref( pThData->dd, bTemp );
+    Cudd_RecursiveDeref( pThData->dd, bCube );
+    pThData->bRes = bGroup;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the next clusters of the schedule concurrently.]
+
+  Description [Each thread builds one cluster in its own manager, which
+  uses the current variable order of the main manager. The clusters are
+  then transferred into the main manager. Clusters are built in batches
+  of nThreads, so that no more than nThreads of them are alive at once.
+  Returns the number of clusters built, or -1 on timeout.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_ManComputeClustersPar( Llb_Man_t * p, Llb_ThData_t * pThData, int nThreads, int kStart, int fBackward, DdNode ** pRes )
+{
+    pthread_t WorkerThread[LLB_PAR_MAX];
+    int * pOrder, i, k, nBatch, status, RetValue;
+    nBatch = Abc_MinInt( nThreads, p->pMatrix->nCols - 1 - kStart );
+    // make the worker managers follow the current order of the main manager
+    pOrder = ABC_ALLOC( int, Cudd_ReadSize(p->dd) );
+    for ( i = 0; i < Cudd_ReadSize(p->dd); i++ )
+        pOrder[i] = Cudd_ReadInvPerm( p->dd, i );
+    for ( k = 0; k < nBatch; k++ )
+    {
+        pThData[k].Index     = fBackward ? p->pMatrix->nCols - 1 - (kStart + k) : kStart + k;
+        pThData[k].pGroup    = p->pMatrix->pColGrps[pThData[k].Index];
+        pThData[k].fBackward = fBackward;
+        pThData[k].dd->TimeStop = p->dd->TimeStop;
+        Cudd_ShuffleHeap( pThData[k].dd, pOrder );
+        status = pthread_create( WorkerThread + k, NULL, Llb_ManClusterThread, (void *)(pThData + k) );  assert( status == 0 );
+    }
+    ABC_FREE( pOrder );
+    for ( k = 0; k < nBatch; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+    }
+    // transfer the results
+    RetValue = nBatch;
+    for ( k = 0; k < nBatch; k++ )
+    {
+        pRes[k] = NULL;
+        if ( pThData[k].bRes == NULL )
+        {
+            RetValue = -1;
+            continue;
+        }
+        if ( RetValue > 0 )
+        {
+            pRes[k] = Cudd_bddTransfer( pThData[k].dd, p->dd, pThData[k].bRes );
+            if ( pRes[k] == NULL )
+                RetValue = -1;
+            else
+                Cudd_Ref( pRes[k] );
+        }
+        Cudd_RecursiveDeref( pThData[k].dd, pThData[k].bRes );
+        pThData[k].bRes = NULL;
+    }
+    if ( RetValue == -1 )
+        for ( k = 0; k < nBatch; k++ )
+            if ( pRes[k] )
+                Cudd_RecursiveDeref( p->dd, pRes[k] );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the worker managers.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Llb_ThData_t * Llb_ManClusterThreadsStart( Llb_Man_t * p, int nThreads )
+{
+    Llb_ThData_t * pThData = ABC_CALLOC( Llb_ThData_t, nThreads );
+    int k;
+    for ( k = 0; k < nThreads; k++ )
+    {
+        pThData[k].p     = p;
+        pThData[k].dd    = Cudd_Init( Cudd_ReadSize(p->dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        pThData[k].pBdds = ABC_CALLOC( DdNode *, Aig_ManObjNumMax(p->pAig) );
+        Cudd_AutodynDisable( pThData[k].dd );
+    }
+    return pThData;
+}
+void Llb_ManClusterThreadsStop( Llb_ThData_t * pThData, int nThreads )
+{
+    int k;
+    for ( k = 0; k < nThreads; k++ )
+    {
+        Extra_StopManager( pThData[k].dd );
+        ABC_FREE( pThData[k].pBdds );
+    }
+    ABC_FREE( pThData );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds all clusters concurrently and keeps them.]
+
+  Description [The clusters (with their internal variables quantified)
+  do not depend on the state set, so they are built once and reused by
+  every image computation. If their shared size exceeds the BDD size
+  limit, they are dropped and the image computation builds them again
+  in batches for each image. Returns 1 if the clusters are available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_ManPrepareClustersPar( Llb_Man_t * p, int nThreads, int fBackward )
+{
+    Llb_ThData_t * pThData;
+    DdNode * pBatch[LLB_PAR_MAX], * bTemp;
+    int i, k, nBatch = 0, Index;
+    if ( p->vClusters && p->fClustersBwd == fBackward )
+        return 1;
+    if ( p->fClustersBig )
+        return 0;
+    if ( p->vClusters )
+    {
+        Vec_PtrForEachEntry( DdNode *, p->vClusters, bTemp, i )
+            if ( bTemp )
+                Cudd_RecursiveDeref( p->dd, bTemp );
+        Vec_PtrFreeP( &p->vClusters );
+    }
+    p->vClusters = Vec_PtrStart( p->pMatrix->nCols );
+    p->fClustersBwd = fBackward;
+    pThData = Llb_ManClusterThreadsStart( p, nThreads );
+    for ( k = 1; k < p->pMatrix->nCols-1; k += nBatch )
+    {
+        nBatch = Llb_ManComputeClustersPar( p, pThData, nThreads, k, fBackward, pBatch );
+        if ( nBatch == -1 )
+            break;
+        for ( i = 0; i < nBatch; i++ )
+        {
+            Index = fBackward ? p->pMatrix->nCols - 1 - (k + i) : k + i;
+            Vec_PtrWriteEntry( p->vClusters, Index, pBatch[i] );
+        }
+    }
+    Llb_ManClusterThreadsStop( pThData, nThreads );
+    if ( nBatch != -1 && Cudd_SharingSize( (DdNode **)Vec_PtrArray(p->vClusters) + 1, p->pMatrix->nCols - 2 ) <= p->pPars->nBddMax )
+        return 1;
+    // the clusters cannot be kept
+    p->fClustersBig = (nBatch != -1);
+    Vec_PtrForEachEntry( DdNode *, p->vClusters, bTemp, i )
+        if ( bTemp )
+            Cudd_RecursiveDeref( p->dd, bTemp );
+    Vec_PtrFreeP( &p->vClusters );
+    return 0;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -331,6 +571,18 @@ DdNode * Llb_ManComputeImage( Llb_Man_t * p, DdNode * bInit, int fBackward )
     Llb_Grp_t * pGroup;
     DdNode * bImage, * bGroup, * bCube, * bTemp;
     int k, Index;
+#ifdef ABC_USE_PTHREADS
+    DdNode * pBatch[LLB_PAR_MAX];
+    Llb_ThData_t * pThData = NULL;
+    int nThreads = Abc_MinInt( p->pPars->nProcs, LLB_PAR_MAX );
+    int kBatch = 0, nBatch = 0, fCached = 0;
+    if ( nThreads > 1 && p->pMatrix->nCols > 3 )
+    {
+        fCached = Llb_ManPrepareClustersPar( p, nThreads, fBackward );
+        if ( !fCached && p->fClustersBig )
+            pThData = Llb_ManClusterThreadsStart( p, nThreads );
+    }
+#endif
     bImage = bInit;  Cudd_Ref( bImage );
     for ( k = 1; k < p->pMatrix->nCols-1; k++ )
     {
@@ -338,9 +590,36 @@ DdNode * Llb_ManComputeImage( Llb_Man_t * p, DdNode * bInit, int fBackward )
             Index = p->pMatrix->nCols - 1 - k;
         else
             Index = k;
+        pGroup = p->pMatrix->pColGrps[Index];
 
+#ifdef ABC_USE_PTHREADS
+        if ( fCached )
+        {
+            // take the cluster kept in the manager
+            bGroup = (DdNode *)Vec_PtrEntry( p->vClusters, Index );
+            Cudd_Ref( bGroup );
+        }
+        else if ( pThData )
+        {
+            // take the cluster built by the threads
+            if ( k >= kBatch + nBatch )
+            {
+                kBatch = k;
+                nBatch = Llb_ManComputeClustersPar( p, pThData, nThreads, k, fBackward, pBatch );
+                if ( nBatch == -1 )
+                {
+                    Llb_ManClusterThreadsStop( pThData, nThreads );
+                    Cudd_RecursiveDeref( p->dd, bImage );
+                    return NULL;
+                }
+            }
+            bGroup = pBatch[k - kBatch];
+            pBatch[k - kBatch] = NULL;
+        }
+        else
+#endif
+        {
         // compute group BDD
-        pGroup = p->pMatrix->pColGrps[Index];
         bGroup = Llb_ManConstructGroupBdd( p, pGroup );
         if ( bGroup == NULL )
         {
@@ -360,6 +639,7 @@ DdNode * Llb_ManComputeImage( Llb_Man_t * p, DdNode * bInit, int fBackward )
         Cudd_Ref( bGroup );
         Cudd_RecursiveDeref( p->dd, bTemp );
         Cudd_RecursiveDeref( p->dd, bCube );
+        }
         // perform partial product
         if ( fBackward )
             bCube  = Llb_ManConstructQuantCubeBwd( p, pGroup, Index );
@@ -373,6 +653,14 @@ DdNode * Llb_ManComputeImage( Llb_Man_t * p, DdNode * bInit, int fBackward )
             Cudd_RecursiveDeref( p->dd, bTemp );
             Cudd_RecursiveDeref( p->dd, bGroup );
             Cudd_RecursiveDeref( p->dd, bCube );
+#ifdef ABC_USE_PTHREADS
+            if ( pThData )
+            {
+                for ( k = k - kBatch + 1; k < nBatch; k++ )
+                    Cudd_RecursiveDeref( p->dd, pBatch[k] );
+                Llb_ManClusterThreadsStop( pThData, nThreads );
+            }
+#endif
             return NULL;
         }
         Cudd_Ref( bImage );
@@ -380,6 +668,10 @@ DdNode * Llb_ManComputeImage( Llb_Man_t * p, DdNode * bInit, int fBackward )
         Cudd_RecursiveDeref( p->dd, bGroup );
         Cudd_RecursiveDeref( p->dd, bCube );
     }
+#ifdef ABC_USE_PTHREADS
+    if ( pThData )
+        Llb_ManClusterThreadsStop( pThData, nThreads );
+#endif
 
     // make sure image depends on next state vars
     if ( fCheckSupport )
@@ -64,6 +64,10 @@ struct Llb_Man_t_
     Vec_Ptr_t *     vRings;         // onion rings
     Vec_Int_t *     vVarBegs;       // the first group where the var appears  
     Vec_Int_t *     vVarEnds;       // the last group where the var appears 
+    Vec_Ptr_t *     vObjBdds;       // the BDDs of the AIG objects while constructing groups
+    Vec_Ptr_t *     vClusters;      // the clusters built by the threads (in dd)
+    int             fClustersBwd;   // the clusters are built for backward image
+    int             fClustersBig;   // the clusters do not fit into the BDD size limit
     // variable mapping
     Vec_Int_t *     vNs2Glo;        // next state variables into global variables
     Vec_Int_t *     vCs2Glo;        // next state variables into global variables
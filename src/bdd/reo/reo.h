@@ -193,6 +193,8 @@ extern void       Extra_ReorderArray( reo_man * p, DdManager * dd, DdNode * Func
 // ======================= reoCore.c =======================================
 extern void       reoReorderArray( reo_man * p, DdManager * dd, DdNode * Funcs[], DdNode * FuncsRes[], int nFuncs, int * pOrder );
 extern void       reoResizeStructures( reo_man * p, int nDdVarsMax, int nNodesMax, int nFuncs );
+// ======================= reoPar.c =======================================
+extern void       Extra_ReorderManagers( DdManager ** pDds, int nDds, int nThreads, int TimeLimit, int ** pOrders, int fVerbose );
 // ======================= reoProfile.c ======================================
 extern void       reoProfileNodesStart( reo_man * p );
 extern void       reoProfileAplStart( reo_man * p );
@@ -0,0 +1,295 @@
+/**CFile****************************************************************
+
+  FileName    [reoPar.c]
+
+  PackageName [REO: A specialized DD reordering engine.]
+
+  Synopsis    [Concurrent reordering of independent DD managers.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "reo.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define REO_PAR_MAX 64
+
+// the state shared by the threads reordering the managers
+typedef struct reo_batch_ reo_batch;
+struct reo_batch_
+{
+    DdManager **    pDds;         // the managers to be reordered
+    int             nDds;         // the number of managers
+    int             iNext;        // the next manager to be reordered
+    abctime         TimeStop;     // the shared deadline (0 if no limit)
+    int **          pSupps;       // the variables with live nodes in each manager
+    int **          pOrders;      // the orders found for the managers reordered so far
+    int             fVerbose;     // verbosity flag
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;        // protects iNext and pOrders
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DEFINITIONS                          ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the variables with live nodes in the manager.]
+
+  Description [Returns the array of size dd->size, in which the entry is 1
+  if the variable has at least one live node other than its projection
+  function, which every variable keeps in its subtable.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int * reoManagerSupport( DdManager * dd )
+{
+    int v, * pSupp = ABC_CALLOC( int, dd->size );
+    for ( v = 0; v < dd->size; v++ )
+        pSupp[v] = (dd->subtables[dd->perm[v]].keys - dd->subtables[dd->perm[v]].dead > 1);
+    return pSupp;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the order to be used as a starting point.]
+
+  Description [Among the managers reordered so far, selects the one with
+  the same number of variables whose live support overlaps the support of
+  the given manager the most. Returns the order of that manager, or NULL
+  if no manager shares at least half of the variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int * reoManagerSeed( reo_batch * p, int iDd )
+{
+    DdManager * dd = p->pDds[iDd];
+    int * pSupp = p->pSupps[iDd];
+    int i, v, nCommon, nUnion, * pBest = NULL;
+    double Ratio, RatioBest = 0.5;
+    for ( i = 0; i < p->nDds; i++ )
+    {
+        if ( i == iDd || p->pOrders[i] == NULL || p->pDds[i]->size != dd->size )
+            continue;
+        nCommon = nUnion = 0;
+        for ( v = 0; v < dd->size; v++ )
+        {
+            nCommon += (pSupp[v] && p->pSupps[i][v]);
+            nUnion  += (pSupp[v] || p->pSupps[i][v]);
+        }
+        Ratio = nUnion ? (double)nCommon / nUnion : 0.0;
+        if ( RatioBest < Ratio )
+        {
+            RatioBest = Ratio;
+            pBest = p->pOrders[i];
+        }
+    }
+    return pBest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reorders one manager of the batch.]
+
+  Description [If a manager with a similar support has already been
+  reordered, its order is tried first and kept when it does not increase
+  the number of live nodes. Then symmetric sifting is performed until the
+  shared deadline.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void reoManagerReorder( reo_batch * p, int iDd )
+{
+    DdManager * dd = p->pDds[iDd];
+    abctime TimeStopOld = dd->TimeStop;
+    int v, nNodes0, nNodes1, fSeeded = 0;
+    int * pSeed, * pOrder = ABC_ALLOC( int, dd->size );
+    nNodes0 = Cudd_ReadKeys(dd) - Cudd_ReadDead(dd);
+    // try the order of a similar manager
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    pSeed = reoManagerSeed( p, iDd );
+    if ( pSeed )
+        memcpy( pOrder, pSeed, sizeof(int) * dd->size );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    if ( pSeed && (p->TimeStop == 0 || Abc_Clock() < p->TimeStop) )
+    {
+        int * pOrderOld = ABC_ALLOC( int, dd->size );
+        for ( v = 0; v < dd->size; v++ )
+            pOrderOld[v] = dd->invperm[v];
+        Cudd_ShuffleHeap( dd, pOrder );
+        if ( Cudd_ReadKeys(dd) - Cudd_ReadDead(dd) > (unsigned)nNodes0 )
+            Cudd_ShuffleHeap( dd, pOrderOld );
+        else
+            fSeeded = 1;
+        ABC_FREE( pOrderOld );
+    }
+    // sift under the shared deadline
+    if ( p->TimeStop == 0 || Abc_Clock() < p->TimeStop )
+    {
+        dd->TimeStop = p->TimeStop;
+        Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 1 );
+        dd->TimeStop = TimeStopOld;
+    }
+    nNodes1 = Cudd_ReadKeys(dd) - Cudd_ReadDead(dd);
+    // publish the resulting order
+    for ( v = 0; v < dd->size; v++ )
+        pOrder[v] = dd->invperm[v];
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    p->pOrders[iDd] = pOrder;
+    if ( p->fVerbose )
+        printf( "Manager %4d :  Nodes = %8d -> %8d.  %s\n", iDd, nNodes0, nNodes1, fSeeded ? "Seeded." : "" );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the managers from the batch one at a time.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * reoManagerThread( void * pArg )
+{
+    reo_batch * p = (reo_batch *)pArg;
+    int iDd;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        iDd = p->iNext < p->nDds ? p->iNext++ : -1;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iDd == -1 )
+            break;
+        reoManagerReorder( p, iDd );
+    }
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Reorders a batch of independent DD managers.]
+
+  Description [Performs symmetric sifting in each of the nDds managers,
+  using up to nThreads threads, each of which takes the next manager as
+  soon as it is done with the previous one. The managers should not share
+  nodes and should not be used by other threads while this procedure runs.
+  The time limit (in seconds, 0 means no limit) is shared by the batch:
+  when it expires, the managers not yet reordered are left unchanged.
+  The orders found so far are used as starting points for the managers
+  whose live variables are similar. If pOrders is not NULL, it is filled
+  with the resulting variable orders (levels to variables), which should
+  be freed by the user.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Extra_ReorderManagers( DdManager ** pDds, int nDds, int nThreads, int TimeLimit, int ** pOrders, int fVerbose )
+{
+    reo_batch Batch, * p = &Batch;
+    abctime clk = Abc_Clock();
+    int i;
+    memset( p, 0, sizeof(reo_batch) );
+    p->pDds     = pDds;
+    p->nDds     = nDds;
+    p->TimeStop = TimeLimit ? Abc_Clock() + (abctime)TimeLimit * CLOCKS_PER_SEC : 0;
+    p->pSupps   = ABC_CALLOC( int *, nDds );
+    p->pOrders  = ABC_CALLOC( int *, nDds );
+    p->fVerbose = fVerbose;
+    for ( i = 0; i < nDds; i++ )
+        p->pSupps[i] = reoManagerSupport( pDds[i] );
+    nThreads = Abc_MaxInt( 1, Abc_MinInt( nThreads, Abc_MinInt(nDds, REO_PAR_MAX) ) );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[REO_PAR_MAX];
+        int status;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, reoManagerThread, (void *)p );  assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+    }
+    else
+#endif
+    for ( i = 0; i < nDds; i++ )
+        reoManagerReorder( p, i );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    if ( fVerbose )
+        ABC_PRT( "Reordering time", Abc_Clock() - clk );
+    for ( i = 0; i < nDds; i++ )
+    {
+        ABC_FREE( p->pSupps[i] );
+        if ( pOrders )
+            pOrders[i] = p->pOrders[i];
+        else
+            ABC_FREE( p->pOrders[i] );
+    }
+    ABC_FREE( p->pSupps );
+    ABC_FREE( p->pOrders );
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                         END OF FILE                              ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
+
@@ -65,6 +65,15 @@
 #endif
 #endif
 
+// the storage class of variables private to each thread
+#if !defined(ABC_THREAD_LOCAL)
+#if defined(_MSC_VER)
+#define ABC_THREAD_LOCAL __declspec(thread)
+#else
+#define ABC_THREAD_LOCAL __thread
+#endif
+#endif
+
 /*
 #ifdef __cplusplus
 #error "C++ code"
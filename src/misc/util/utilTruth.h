@@ -593,6 +593,47 @@ static inline int Abc_TtIntersectXor( word * pOut, int fComp, word * pIn0, word
     }
     return 0;
 }
+// these return the bit-mask of the polarities (bit i stands for polarity i)
+// for which Abc_TtIntersectOne/Two/Xor( pOut, 0, ... ) would return 1;
+// the words are scanned once and the scan stops when all bits in MaskStop are found
+static inline int Abc_TtIntersectOnePolar( word * pOut, word * pIn, int nWords )
+{
+    int w, Mask = 0;
+    for ( w = 0; w < nWords; w++ )
+    {
+        Mask |= (int)((pOut[w] & pIn[w]) != 0) | ((int)((pOut[w] & ~pIn[w]) != 0) << 1);
+        if ( Mask == 3 )
+            return 3;
+    }
+    return Mask;
+}
+static inline int Abc_TtIntersectXorPolar( word * pOut, word * pIn0, word * pIn1, int nWords )
+{
+    int w, Mask = 0;
+    for ( w = 0; w < nWords; w++ )
+    {
+        word Xor = pIn0[w] ^ pIn1[w];
+        Mask |= (int)((pOut[w] & Xor) != 0) | ((int)((pOut[w] & ~Xor) != 0) << 1);
+        if ( Mask == 3 )
+            return 3;
+    }
+    return Mask;
+}
+// polarity n complements pIn0 if (n & 1) and pIn1 if (n >> 1)
+static inline int Abc_TtIntersectTwoPolar( word * pOut, word * pIn0, word * pIn1, int MaskStop, int nWords )
+{
+    int w, Mask = 0;
+    for ( w = 0; w < nWords; w++ )
+    {
+        word Pos = pOut[w] &  pIn0[w];
+        word Neg = pOut[w] & ~pIn0[w];
+        Mask |=  (int)((Pos &  pIn1[w]) != 0)       | ((int)((Neg &  pIn1[w]) != 0) << 1) |
+                ((int)((Pos & ~pIn1[w]) != 0) << 2) | ((int)((Neg & ~pIn1[w]) != 0) << 3);
+        if ( (Mask & MaskStop) == MaskStop )
+            return Mask;
+    }
+    return Mask;
+}
 static inline int Abc_TtEqual( word * pIn1, word * pIn2, int nWords )
 {
     int w;
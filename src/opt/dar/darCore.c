@@ -20,6 +20,17 @@
 
 #include "darInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -33,6 +44,25 @@ ABC_NAMESPACE_IMPL_START
           p->iNext && (((pObj) = Aig_ManObj(p, p->iNext)), 1);                  \
           p->iNext = p->pOrderData[2*p->iPrev+1] )
 
+#define DAR_PAR_MAX     64      // the max number of threads
+#define DAR_PAR_WINDOW  100000  // the number of nodes evaluated before committing the changes
+#define DAR_PAR_CHUNK   1000    // the number of nodes taken by a thread at a time
+
+// the window of nodes whose cuts are evaluated concurrently
+typedef struct Dar_ParWin_t_ Dar_ParWin_t;
+struct Dar_ParWin_t_
+{
+    Dar_Man_t *      pMan;           // the rewriting manager
+    Vec_Int_t *      vNodes;         // the IDs of the nodes in the window
+    Dar_Cut_t *      pCuts;          // the best cut of each node
+    int *            pGains;         // the best gain of each node (-1 if none)
+    int              iNext;          // the next node to be evaluated
+    Vec_Ptr_t *      vLibs;          // the private libraries of the finished threads
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;          // protects iNext and the statistics
+#endif
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -59,12 +89,260 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fUseZeros    =  0;
     pPars->fPower       =  0;
     pPars->fRecycle     =  1;
+    pPars->nThreads     =  1;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
 }
 
 #define MAX_VAL 10
 
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the cuts of one node without changing the AIG.]
+
+  Description [Returns the best cut of the node and its gain. The gain is
+  ABC_INFINITY if the node can be replaced by a constant or by a cut leaf,
+  and -1 if the node is not worth rewriting.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManEvalNode( Dar_Man_t * p, Aig_Obj_t * pObj, Dar_Cut_t * pCutBest, int * pGainBest )
+{
+    Dar_Cut_t * pCut, Cut;
+    int k, Required, GainPrev, LevelPrev, nMffcSize = -1;
+    *pGainBest = -1;
+    // check if there is a trivial cut
+    Dar_ObjForEachCut( pObj, pCut, k )
+        if ( pCut->nLeaves == 0 || (pCut->nLeaves == 1 && pCut->pLeaves[0] != pObj->Id && Aig_ManObj(p->pAig, pCut->pLeaves[0])) )
+        {
+            *pCutBest  = *pCut;
+            *pGainBest = ABC_INFINITY;
+            return;
+        }
+    // evaluate the cuts
+    p->GainBest = -1;
+    Required    = p->pAig->vLevelR? Aig_ObjRequiredLevel(p->pAig, pObj) : ABC_INFINITY;
+    Dar_ObjForEachCut( pObj, pCut, k )
+    {
+        GainPrev  = p->GainBest;
+        LevelPrev = p->LevelBest;
+        Cut = *pCut;
+        if ( Cut.nLeaves == 3 )
+            Cut.pLeaves[Cut.nLeaves++] = 0;
+        Dar_LibEval( p, pObj, &Cut, Required, &nMffcSize );
+        if ( p->GainBest != GainPrev || p->LevelBest != LevelPrev )
+            *pCutBest = *pCut;
+    }
+    if ( p->GainBest >= p->pPars->nMinSaved )
+        *pGainBest = p->GainBest;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the nodes of the window taking them in chunks.]
+
+  Description [Each thread uses a private copy of the library, which is 
+  returned to the window when the thread is finished, and its own 
+  evaluation manager, which collects the MFFCs without changing the AIG.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Dar_ManEvalThread( void * pArg )
+{
+    Dar_ParWin_t * pWin = (Dar_ParWin_t *)pArg;
+    Dar_Man_t * pMan = pWin->pMan, * p;
+    void * pLib;
+    int i, iBeg, iEnd;
+    pthread_mutex_lock( &pWin->Mutex );
+    pLib = Vec_PtrSize(pWin->vLibs) ? Vec_PtrPop(pWin->vLibs) : NULL;
+    pthread_mutex_unlock( &pWin->Mutex );
+    if ( pLib )
+        Dar_LibSwapPrivate( pLib );
+    else
+    {
+        Dar_LibStartPrivate();
+        Dar_LibPrepare( pMan->pPars->nSubgMax );
+    }
+    p = ABC_CALLOC( Dar_Man_t, 1 );
+    p->pPars       = pMan->pPars;
+    p->pAig        = pMan->pAig;
+    p->vLeavesBest = Vec_PtrAlloc( 4 );
+    p->vMffc       = Vec_PtrAlloc( 100 );
+    p->vMffcVisit  = Vec_PtrAlloc( 100 );
+    p->vMffcRefs   = Vec_IntAlloc( 100 );
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pWin->Mutex );
+        iBeg = pWin->iNext;
+        iEnd = pWin->iNext = Abc_MinInt( iBeg + DAR_PAR_CHUNK, Vec_IntSize(pWin->vNodes) );
+        pthread_mutex_unlock( &pWin->Mutex );
+        if ( iBeg == iEnd )
+            break;
+        for ( i = iBeg; i < iEnd; i++ )
+            Dar_ManEvalNode( p, Aig_ManObj(p->pAig, Vec_IntEntry(pWin->vNodes, i)), pWin->pCuts + i, pWin->pGains + i );
+    }
+    // add the statistics to those of the rewriting manager
+    pthread_mutex_lock( &pWin->Mutex );
+    pMan->nTotalSubgs += p->nTotalSubgs;
+    pMan->nCutsBad    += p->nCutsBad;
+    pMan->nCutsGood   += p->nCutsGood;
+    for ( i = 0; i < 222; i++ )
+        pMan->ClassSubgs[i] += p->ClassSubgs[i];
+    Vec_PtrPush( pWin->vLibs, Dar_LibSwapPrivate(NULL) );
+    pthread_mutex_unlock( &pWin->Mutex );
+    Vec_PtrFree( p->vLeavesBest );
+    Vec_PtrFree( p->vMffc );
+    Vec_PtrFree( p->vMffcVisit );
+    Vec_IntFree( p->vMffcRefs );
+    ABC_FREE( p );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the nodes in windows evaluated concurrently.]
+
+  Description [The nodes are processed in windows of DAR_PAR_WINDOW nodes.
+  For each window, the cuts are computed first, and then the threads find
+  the best replacement of each node against the unchanged AIG. Finally,
+  the replacements are committed one at a time in the order of decreasing
+  gain. Before a replacement is committed, its cut is evaluated again using
+  the current reference counters, so the replacements made obsolete by the 
+  previous ones (because the node or a cut leaf was removed, or because 
+  the MFFC is now shared) are skipped. The result does not depend on the 
+  number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManRewritePar( Dar_Man_t * p, int nNodesOld )
+{
+    Aig_Man_t * pAig = p->pAig;
+    pthread_t WorkerThread[DAR_PAR_MAX];
+    Dar_ParWin_t Win, * pWin = &Win;
+    Dar_Cut_t * pCut, Cut;
+    Aig_Obj_t * pObj, * pObjNew, * pLeaf;
+    Vec_Wrd_t * vOrder;
+    void * pLib;
+    word Entry;
+    int i, j, k, iStart, nThreads, status, Required, nMffcSize, nNodeBefore, nNodeAfter;
+    abctime clk;
+    nThreads = Abc_MinInt( p->pPars->nThreads, DAR_PAR_MAX );
+    memset( pWin, 0, sizeof(Dar_ParWin_t) );
+    pWin->pMan   = p;
+    pWin->vNodes = Vec_IntAlloc( DAR_PAR_WINDOW );
+    pWin->pCuts  = ABC_ALLOC( Dar_Cut_t, DAR_PAR_WINDOW );
+    pWin->pGains = ABC_ALLOC( int, DAR_PAR_WINDOW );
+    pWin->vLibs  = Vec_PtrAlloc( nThreads );
+    vOrder = Vec_WrdAlloc( DAR_PAR_WINDOW );
+    pthread_mutex_init( &pWin->Mutex, NULL );
+    for ( iStart = 0; iStart < nNodesOld; iStart += DAR_PAR_WINDOW )
+    {
+        if ( pAig->Time2Quit && Abc_Clock() > pAig->Time2Quit )
+            break;
+        // compute the cuts of the nodes in the window
+clk = Abc_Clock();
+        Dar_ManCutsRestart( p, NULL );
+        Vec_IntClear( pWin->vNodes );
+        for ( i = iStart; i < Abc_MinInt(iStart + DAR_PAR_WINDOW, nNodesOld); i++ )
+        {
+            pObj = Aig_ManObj( pAig, i );
+            if ( pObj == NULL || !Aig_ObjIsNode(pObj) )
+                continue;
+            Dar_ObjComputeCuts_rec( p, pObj );
+            Vec_IntPush( pWin->vNodes, i );
+        }
+        p->nNodesTried += Vec_IntSize( pWin->vNodes );
+p->timeCuts += Abc_Clock() - clk;
+        // find the best replacements concurrently
+clk = Abc_Clock();
+        pWin->iNext = 0;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Dar_ManEvalThread, (void *)pWin );  assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+p->timeEval += Abc_Clock() - clk;
+        // order the replacements by gain
+        Vec_WrdClear( vOrder );
+        for ( i = 0; i < Vec_IntSize(pWin->vNodes); i++ )
+            if ( pWin->pGains[i] >= 0 )
+                Vec_WrdPush( vOrder, ((word)(ABC_INFINITY - pWin->pGains[i]) << 32) | (word)i );
+        Vec_WrdSort( vOrder, 0 );
+        // remove the cuts before changing the AIG
+        Dar_ManCutsRestart( p, NULL );
+        // commit the replacements that are still valid
+        Vec_WrdForEachEntry( vOrder, Entry, k )
+        {
+            i    = (int)(Entry & 0xFFFFFFFF);
+            pObj = Aig_ManObj( pAig, Vec_IntEntry(pWin->vNodes, i) );
+            pCut = pWin->pCuts + i;
+            if ( pObj == NULL || !Aig_ObjIsNode(pObj) )
+                continue;
+            // skip the cut if one of its leaves was removed
+            Dar_CutForEachLeaf( pAig, pCut, pLeaf, j )
+                if ( pLeaf == NULL )
+                    break;
+            if ( j < (int)pCut->nLeaves )
+                continue;
+            if ( pWin->pGains[i] == ABC_INFINITY ) // replace by constant or by a leaf
+            {
+                if ( pCut->nLeaves == 0 )
+                    pObjNew = Aig_NotCond( Aig_ManConst1(pAig), pCut->uTruth==0 );
+                else
+                    pObjNew = Aig_NotCond( Aig_ManObj(pAig, pCut->pLeaves[0]), pCut->uTruth==0x5555 );
+                Aig_ObjReplace( pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
+                continue;
+            }
+            // evaluate the cut again using the current AIG
+            p->GainBest = -1;
+            Required = pAig->vLevelR? Aig_ObjRequiredLevel(pAig, pObj) : ABC_INFINITY;
+            Cut = *pCut;
+            if ( Cut.nLeaves == 3 )
+                Cut.pLeaves[Cut.nLeaves++] = 0;
+            Dar_LibEval( p, pObj, &Cut, Required, &nMffcSize );
+            if ( p->GainBest < p->pPars->nMinSaved )
+                continue;
+            nNodeBefore = Aig_ManNodeNum( pAig );
+            pObjNew = Dar_LibBuildBest( p ); // pObjNew can be complemented!
+            pObjNew = Aig_NotCond( pObjNew, Aig_ObjPhaseReal(pObjNew) ^ pObj->fPhase );
+            assert( (int)Aig_Regular(pObjNew)->Level <= Required );
+            Aig_ObjReplace( pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
+            nNodeAfter = Aig_ManNodeNum( pAig );
+            assert( p->GainBest <= nNodeBefore - nNodeAfter );
+            p->ClassGains[p->ClassBest] += nNodeBefore - nNodeAfter;
+        }
+    }
+    pthread_mutex_destroy( &pWin->Mutex );
+    // free the private libraries of the threads
+    Vec_PtrForEachEntry( void *, pWin->vLibs, pLib, i )
+    {
+        pLib = Dar_LibSwapPrivate( pLib );
+        Dar_LibStopPrivate();
+        Dar_LibSwapPrivate( pLib );
+    }
+    Vec_PtrFree( pWin->vLibs );
+    Vec_WrdFree( vOrder );
+    Vec_IntFree( pWin->vNodes );
+    ABC_FREE( pWin->pCuts );
+    ABC_FREE( pWin->pGains );
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -110,6 +388,11 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     nNodesOld = Vec_PtrSize( pAig->vObjs );
 
 //    pProgress = Bar_ProgressStart( stdout, nNodesOld );
+#ifdef ABC_USE_PTHREADS
+    if ( pPars->nThreads > 1 && !pPars->fPower )
+        Dar_ManRewritePar( p, nNodesOld );
+    else
+#endif
     Aig_ManForEachObj( pAig, pObj, i )
 //    pProgress = Bar_ProgressStart( stdout, 100 );
 //    Aig_ManOrderStart( pAig );
@@ -80,6 +80,9 @@ struct Dar_Man_t_
     int              GainBest;       // the best gain
     int              LevelBest;      // the level of node with the best gain
     int              ClassBest;      // the equivalence class of the best replacement
+    Vec_Ptr_t *      vMffc;          // the MFFC nodes (when evaluating without changing the AIG)
+    Vec_Ptr_t *      vMffcVisit;     // the nodes visited while collecting the MFFC
+    Vec_Int_t *      vMffcRefs;      // the remaining references of the visited nodes
     // function statistics
     int              nTotalSubgs;    // the total number of subgraphs tried
     int              ClassTimes[222];// the runtimes for each class
@@ -105,7 +105,11 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
-static Dar_Lib_t * s_DarLib = NULL;
+static Dar_Lib_t * s_DarLibMain = NULL;
+static ABC_THREAD_LOCAL Dar_Lib_t * s_DarLibPrivate = NULL;
+
+// the library used by the current thread (its private library if started)
+#define s_DarLib (s_DarLibPrivate ? s_DarLibPrivate : s_DarLibMain)
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -593,10 +597,10 @@ Dar_Lib_t * Dar_LibRead()
 void Dar_LibStart()
 {
 //    abctime clk = Abc_Clock();
-    if ( s_DarLib != NULL )
+    if ( s_DarLibMain != NULL )
         return;
-    assert( s_DarLib == NULL );
-    s_DarLib = Dar_LibRead();
+    assert( s_DarLibMain == NULL );
+    s_DarLibMain = Dar_LibRead();
 //    printf( "The 4-input library started with %d nodes and %d subgraphs. ", s_DarLib->nObjs - 4, s_DarLib->nSubgrTotal );
 //    ABC_PRT( "Time", Abc_Clock() - clk );
 }
@@ -614,9 +618,65 @@ void Dar_LibStart()
 ***********************************************************************/
 void Dar_LibStop()
 {
-    assert( s_DarLib != NULL );
-    Dar_LibFree( s_DarLib );
-    s_DarLib = NULL;
+    assert( s_DarLibMain != NULL );
+    Dar_LibFree( s_DarLibMain );
+    s_DarLibMain = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the library private to the current thread.]
+
+  Description [The library keeps the data of the rewriting in progress, 
+  so the threads rewriting at the same time should use private copies.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_LibStartPrivate()
+{
+    assert( s_DarLibPrivate == NULL );
+    s_DarLibPrivate = Dar_LibRead();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the library private to the current thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_LibStopPrivate()
+{
+    assert( s_DarLibPrivate != NULL );
+    Dar_LibFree( s_DarLibPrivate );
+    s_DarLibPrivate = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the library private to the current thread.]
+
+  Description [Returns the previous private library (or NULL). Allows the
+  threads started repeatedly by the same procedure to reuse the libraries
+  instead of reading them each time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Dar_LibSwapPrivate( void * pLib )
+{
+    Dar_Lib_t * pOld = s_DarLibPrivate;
+    s_DarLibPrivate = (Dar_Lib_t *)pLib;
+    return pOld;
 }
 
 /**Function*************************************************************
@@ -763,6 +823,65 @@ int Dar_LibCutMarkMffc( Aig_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * p
     return nNodes;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the MFFC of the node without changing the AIG.]
+
+  Description [Works like Dar_LibCutMarkMffc() but keeps the remaining 
+  references of the visited nodes in the manager instead of updating the 
+  reference counters and the traversal IDs of the AIG nodes. This way, 
+  several threads can evaluate the cuts of the same AIG at the same time.
+  The MFFC is collected in p->vMffc. To keep the evaluation fast, the 
+  collection stops after DAR_MFFC_MAX nodes, in which case the number of 
+  nodes returned is a lower bound.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define DAR_MFFC_MAX 64
+int Dar_LibCutCollectMffc_rec( Dar_Man_t * p, Aig_Obj_t * pNode, int nLeaves )
+{
+    Aig_Obj_t * pFanin;
+    int i, k, nFanins, Counter = 0;
+    if ( Aig_ObjIsCi(pNode) || Vec_PtrSize(p->vMffc) == DAR_MFFC_MAX )
+        return 0;
+    Vec_PtrPush( p->vMffc, pNode );
+    nFanins = Aig_ObjIsBuf(pNode) ? 1 : 2;
+    for ( i = 0; i < nFanins; i++ )
+    {
+        pFanin = i ? Aig_ObjFanin1(pNode) : Aig_ObjFanin0(pNode);
+        // the cut leaves are not dereferenced
+        for ( k = 0; k < nLeaves; k++ )
+            if ( Aig_Regular(s_DarLib->pDatas[k].pFunc) == pFanin )
+                break;
+        if ( k < nLeaves )
+            continue;
+        // decrement the local copy of the reference counter
+        k = Vec_PtrFind( p->vMffcVisit, pFanin );
+        if ( k == -1 )
+        {
+            k = Vec_PtrSize( p->vMffcVisit );
+            Vec_PtrPush( p->vMffcVisit, pFanin );
+            Vec_IntPush( p->vMffcRefs, pFanin->nRefs );
+        }
+        assert( Vec_IntEntry(p->vMffcRefs, k) > 0 );
+        Vec_IntAddToEntry( p->vMffcRefs, k, -1 );
+        if ( Vec_IntEntry(p->vMffcRefs, k) == 0 )
+            Counter += Dar_LibCutCollectMffc_rec( p, pFanin, nLeaves );
+    }
+    return Counter + (nFanins == 2);
+}
+int Dar_LibCutCollectMffc( Dar_Man_t * p, Aig_Obj_t * pRoot, int nLeaves )
+{
+    assert( Aig_ObjIsNode(pRoot) );
+    Vec_PtrClear( p->vMffc );
+    Vec_PtrClear( p->vMffcVisit );
+    Vec_IntClear( p->vMffcRefs );
+    return Dar_LibCutCollectMffc_rec( p, pRoot, nLeaves );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Evaluates one cut.]
@@ -838,7 +957,10 @@ void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
             // update the level to be more accurate
             pData->Level = Aig_Regular(pData->pFunc)->Level;
             // mark the node if it is part of MFFC
-            pData->fMffc = Aig_ObjIsTravIdCurrent(p->pAig, Aig_Regular(pData->pFunc));
+            if ( p->vMffc )
+                pData->fMffc = (Vec_PtrFind(p->vMffc, Aig_Regular(pData->pFunc)) >= 0);
+            else
+                pData->fMffc = Aig_ObjIsTravIdCurrent(p->pAig, Aig_Regular(pData->pFunc));
             // assign the probability
             if ( p->pPars->fPower )
             {
@@ -930,7 +1052,10 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
     if ( !Dar_LibCutMatch(p, pCut) )
         return;
     // mark MFFC of the node
-    nNodesSaved = Dar_LibCutMarkMffc( p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
+    if ( p->vMffc )
+        nNodesSaved = Dar_LibCutCollectMffc( p, pRoot, pCut->nLeaves );
+    else
+        nNodesSaved = Dar_LibCutMarkMffc( p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
     // evaluate the cut
     Class = s_DarLib->pMap[pCut->uTruth];
     Dar_LibEvalAssignNums( p, Class, pRoot );
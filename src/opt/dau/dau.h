@@ -59,6 +59,7 @@ typedef enum {
 } Dau_DsdType_t;
 
 typedef struct Dss_Man_t_ Dss_Man_t;
+typedef struct Dau_Cache_t_ Dau_Cache_t;
 typedef struct Abc_TtHieMan_t_ Abc_TtHieMan_t;
 typedef unsigned(*TtCanonicizeFunc)(Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int flag);
 
@@ -76,6 +77,15 @@ static inline int Dau_DsdReadVar( char * p )  { if ( *p == '!' ) p++; return *p
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== dauCache.c ==========================================================*/
+extern Dau_Cache_t * Dau_CacheStart( char * pFileName, int fVerbose );
+extern void          Dau_CacheStop( Dau_Cache_t * p );
+extern void          Dau_CacheSync( Dau_Cache_t * p );
+extern void          Dau_CachePrintStats( Dau_Cache_t * p );
+extern int           Dau_CacheLookup( Dau_Cache_t * p, word * pTruth, int nVars, Vec_Int_t * vAig );
+extern int           Dau_CacheInsert( Dau_Cache_t * p, word * pTruth, int nVars, Vec_Int_t * vAig );
+extern Dau_Cache_t * Dau_CacheReadGlobal();
+extern void          Dau_CacheSetGlobal( Dau_Cache_t * p );
 /*=== dauCanon.c ==========================================================*/
 extern unsigned      Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm );
 extern unsigned      Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm );
@@ -0,0 +1,483 @@
+/**CFile****************************************************************
+
+  FileName    [dauCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Persistent cache of resynthesized NPN classes.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+#include "misc/vec/vecMem.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache maps the NPN-canonical form of a function (computed by
+// Abc_TtCanonicize) into the best AIG structure known for it. Structures
+// are stored as arrays of literals: variable 0 is constant 0, variables
+// 1..nVars are the inputs, the following variables are the AND nodes,
+// each given by the pair of its fanin literals; the last entry is the
+// literal of the output. The cost is the number of AND nodes, with ties
+// broken by the number of logic levels.
+
+// The canonical form is computed outside of the mutex. This relies on
+// the scratch buffers of Abc_TtCanonicize being thread-local.
+
+// The cache file is an append-only journal of records
+//   | tag | nbytes | nvars | nlits | truth[nwords] | lits[nlits] | checksum |
+// Records are collected in memory and appended by one write when the cache
+// is synchronized. The records added by other processes are read when the
+// cache is synchronized; damaged records are skipped.
+
+#define DAU_CACHE_JOURNAL_TAG 0x31435344 /* "DSC1" */
+
+struct Dau_Cache_t_
+{
+    char *         pFileName;               // the journal file (or NULL)
+    long           nFileOffset;             // the part of the journal already read
+    Vec_Mem_t *    vTtMems[DAU_MAX_VAR+1];  // canonical functions by the number of inputs
+    Vec_Wec_t *    vAigs[DAU_MAX_VAR+1];    // the best structure of each function
+    Vec_Str_t *    vJournal;                // records not yet appended to the file
+    Vec_Int_t *    vTemp;                   // temporary structure
+    int            fVerbose;                // verbose flag
+    // statistics
+    int            nLookups;                // the number of lookups
+    int            nHits;                   // the number of successful lookups
+    int            nInserts;                // the number of new functions
+    int            nImproved;               // the number of improved structures
+    int            nRead;                   // the number of records read from the file
+    int            nWritten;                // the number of records appended to the file
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;                  // serializes the access by concurrent passes
+#endif
+};
+
+static Dau_Cache_t * s_pDauCache = NULL;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Structure manipulation.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Dau_CacheAigAndNum( Vec_Int_t * vAig )
+{
+    return Vec_IntSize(vAig) / 2;
+}
+static int Dau_CacheAigLevelNum( Vec_Int_t * vAig, int nVars )
+{
+    int pLevels[1024], i, nAnds = Dau_CacheAigAndNum(vAig);
+    if ( 1 + nVars + nAnds > 1024 )
+        return ABC_INFINITY;
+    for ( i = 0; i <= nVars; i++ )
+        pLevels[i] = 0;
+    for ( i = 0; i < nAnds; i++ )
+        pLevels[1 + nVars + i] = 1 + Abc_MaxInt( pLevels[Abc_Lit2Var(Vec_IntEntry(vAig, 2*i))], pLevels[Abc_Lit2Var(Vec_IntEntry(vAig, 2*i+1))] );
+    return pLevels[Abc_Lit2Var(Vec_IntEntryLast(vAig))];
+}
+// returns 1 if the structure is well-formed and does not use constants
+static int Dau_CacheAigCheck( Vec_Int_t * vAig, int nVars )
+{
+    int i, iLit, nAnds = Dau_CacheAigAndNum(vAig);
+    if ( Vec_IntSize(vAig) % 2 == 0 || nAnds > 1000 )
+        return 0;
+    Vec_IntForEachEntry( vAig, iLit, i )
+        if ( Abc_Lit2Var(iLit) == 0 || Abc_Lit2Var(iLit) >= 1 + nVars + Abc_MinInt(i/2, nAnds) )
+            return 0;
+    return 1;
+}
+static int Dau_CacheAigIsBetter( Vec_Int_t * vNew, Vec_Int_t * vOld, int nVars )
+{
+    if ( Dau_CacheAigAndNum(vNew) != Dau_CacheAigAndNum(vOld) )
+        return Dau_CacheAigAndNum(vNew) < Dau_CacheAigAndNum(vOld);
+    return Dau_CacheAigLevelNum(vNew, nVars) < Dau_CacheAigLevelNum(vOld, nVars);
+}
+// applies the NPN transform (fToCanon = 1) or its inverse (fToCanon = 0)
+static void Dau_CacheAigTransform( Vec_Int_t * vAig, int nVars, char * pPerm, unsigned uPhase, int fToCanon, Vec_Int_t * vRes )
+{
+    int pMap[DAU_MAX_VAR+1], i, iLit;
+    // canonical input i is the original input pPerm[i] complemented by bit i of uPhase
+    for ( i = 0; i < nVars; i++ )
+        if ( fToCanon )
+            pMap[1 + (int)pPerm[i]] = Abc_Var2Lit( 1 + i, (uPhase >> i) & 1 );
+        else
+            pMap[1 + i] = Abc_Var2Lit( 1 + (int)pPerm[i], (uPhase >> i) & 1 );
+    Vec_IntClear( vRes );
+    Vec_IntForEachEntry( vAig, iLit, i )
+    {
+        if ( Abc_Lit2Var(iLit) <= nVars )
+            iLit = Abc_LitNotCond( pMap[Abc_Lit2Var(iLit)], Abc_LitIsCompl(iLit) );
+        Vec_IntPush( vRes, iLit );
+    }
+    Vec_IntWriteEntry( vRes, Vec_IntSize(vRes)-1, Abc_LitNotCond(Vec_IntEntryLast(vRes), (uPhase >> nVars) & 1) );
+}
+// canonicizes the function in place; returns the phase
+static unsigned Dau_CacheCanonicize( word * pTruth, int nVars, char * pPerm )
+{
+    if ( nVars < 6 )
+        pTruth[0] = Abc_Tt6Stretch( pTruth[0], nVars );
+    return Abc_TtCanonicize( pTruth, nVars, pPerm );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the structure of the canonical function.]
+
+  Description [Returns 1 if the structure was stored.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Dau_CacheJournalChecksum( char * pData, int nBytes )
+{
+    unsigned uSum = 0;
+    int i;
+    for ( i = 0; i < nBytes; i++ )
+        uSum = uSum * 16777619 ^ (unsigned char)pData[i];
+    return uSum;
+}
+static void Dau_CacheJournalAdd( Dau_Cache_t * p, word * pTruth, int nVars, Vec_Int_t * vAig )
+{
+    int Tag = DAU_CACHE_JOURNAL_TAG, nLits = Vec_IntSize(vAig);
+    int nBytes = 2 * sizeof(int) + sizeof(word) * Abc_TtWordNum(nVars) + sizeof(int) * nLits;
+    int iStart = Vec_StrSize(p->vJournal) + 2 * sizeof(int);
+    unsigned uSum;
+    Vec_StrPushBuffer( p->vJournal, (char *)&Tag, sizeof(int) );
+    Vec_StrPushBuffer( p->vJournal, (char *)&nBytes, sizeof(int) );
+    Vec_StrPushBuffer( p->vJournal, (char *)&nVars, sizeof(int) );
+    Vec_StrPushBuffer( p->vJournal, (char *)&nLits, sizeof(int) );
+    Vec_StrPushBuffer( p->vJournal, (char *)pTruth, sizeof(word) * Abc_TtWordNum(nVars) );
+    Vec_StrPushBuffer( p->vJournal, (char *)Vec_IntArray(vAig), sizeof(int) * nLits );
+    uSum = Dau_CacheJournalChecksum( Vec_StrEntryP(p->vJournal, iStart), nBytes );
+    Vec_StrPushBuffer( p->vJournal, (char *)&uSum, sizeof(unsigned) );
+    p->nWritten++;
+}
+static int Dau_CacheInsertCanon( Dau_Cache_t * p, word * pTruth, int nVars, Vec_Int_t * vAig, int fJournal )
+{
+    Vec_Int_t * vOld;
+    int iFunc;
+    if ( p->vTtMems[nVars] == NULL )
+    {
+        p->vTtMems[nVars] = Vec_MemAllocForTTSimple( nVars );
+        p->vAigs[nVars] = Vec_WecAlloc( 1000 );
+    }
+    iFunc = Vec_MemHashInsert( p->vTtMems[nVars], pTruth );
+    if ( iFunc == Vec_WecSize(p->vAigs[nVars]) )
+    {
+        Vec_IntAppend( Vec_WecPushLevel(p->vAigs[nVars]), vAig );
+        p->nInserts++;
+    }
+    else
+    {
+        vOld = Vec_WecEntry( p->vAigs[nVars], iFunc );
+        if ( !Dau_CacheAigIsBetter(vAig, vOld, nVars) )
+            return 0;
+        Vec_IntClear( vOld );
+        Vec_IntAppend( vOld, vAig );
+        p->nImproved++;
+    }
+    if ( fJournal && p->pFileName )
+        Dau_CacheJournalAdd( p, pTruth, nVars, vAig );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Synchronizes the cache with the journal file.]
+
+  Description [Appends the records collected since the last call and
+  reads the records added by other processes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dau_CacheSync_int( Dau_Cache_t * p )
+{
+    Vec_Int_t * vAig;
+    Vec_Str_t * vRecord;
+    word pTruth[DAU_MAX_WORD];
+    int pHeader[4], nSkipped = 0;
+    unsigned uSum;
+    long Pos;
+    FILE * pFile;
+    if ( p->pFileName == NULL )
+        return;
+    if ( Vec_StrSize(p->vJournal) > 0 )
+    {
+        pFile = fopen( p->pFileName, "ab" );
+        if ( pFile == NULL )
+            printf( "Cannot open file \"%s\" for appending.\n", p->pFileName );
+        else
+        {
+            // unbuffered, so that the records are appended by one write
+            setvbuf( pFile, NULL, _IONBF, 0 );
+            fwrite( Vec_StrArray(p->vJournal), 1, Vec_StrSize(p->vJournal), pFile );
+            fclose( pFile );
+        }
+        Vec_StrClear( p->vJournal );
+    }
+    pFile = fopen( p->pFileName, "rb" );
+    if ( pFile == NULL )
+        return;
+    vAig = Vec_IntAlloc( 100 );
+    vRecord = Vec_StrAlloc( 1000 );
+    fseek( pFile, p->nFileOffset, SEEK_SET );
+    while ( 1 )
+    {
+        Pos = ftell( pFile );
+        if ( fread( pHeader, sizeof(int), 4, pFile ) != 4 )
+            break;
+        if ( pHeader[0] != DAU_CACHE_JOURNAL_TAG || pHeader[2] < 1 || pHeader[2] > DAU_MAX_VAR || pHeader[3] < 1 || pHeader[3] > 2001 ||
+             pHeader[1] != (int)(2 * sizeof(int) + sizeof(word) * Abc_TtWordNum(pHeader[2]) + sizeof(int) * pHeader[3]) )
+        {
+            if ( feof( pFile ) )
+                break;
+            fseek( pFile, Pos + 1, SEEK_SET );
+            nSkipped++;
+            continue;
+        }
+        Vec_StrFill( vRecord, pHeader[1] + sizeof(unsigned), 0 );
+        memcpy( Vec_StrArray(vRecord), pHeader + 2, 2 * sizeof(int) );
+        if ( fread( Vec_StrArray(vRecord) + 2 * sizeof(int), 1, pHeader[1] - 2 * sizeof(int) + sizeof(unsigned), pFile ) != pHeader[1] - 2 * sizeof(int) + sizeof(unsigned) ||
+             ( memcpy( &uSum, Vec_StrArray(vRecord) + pHeader[1], sizeof(unsigned) ), uSum != Dau_CacheJournalChecksum(Vec_StrArray(vRecord), pHeader[1]) ) )
+        {
+            // the record at the end may still be written by another process
+            if ( feof( pFile ) )
+                break;
+            fseek( pFile, Pos + 1, SEEK_SET );
+            nSkipped++;
+            continue;
+        }
+        Vec_IntFill( vAig, pHeader[3], 0 );
+        memcpy( pTruth, Vec_StrArray(vRecord) + 2 * sizeof(int), sizeof(word) * Abc_TtWordNum(pHeader[2]) );
+        memcpy( Vec_IntArray(vAig), Vec_StrArray(vRecord) + 2 * sizeof(int) + sizeof(word) * Abc_TtWordNum(pHeader[2]), sizeof(int) * pHeader[3] );
+        if ( Dau_CacheAigCheck(vAig, pHeader[2]) )
+            p->nRead += Dau_CacheInsertCanon( p, pTruth, pHeader[2], vAig, 0 );
+    }
+    p->nFileOffset = Pos;
+    fclose( pFile );
+    Vec_StrFree( vRecord );
+    Vec_IntFree( vAig );
+    if ( nSkipped && p->fVerbose )
+        printf( "Skipped %d bytes of damaged records in file \"%s\".\n", nSkipped, p->pFileName );
+}
+void Dau_CacheSync( Dau_Cache_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    Dau_CacheSync_int( p );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dau_Cache_t * Dau_CacheStart( char * pFileName, int fVerbose )
+{
+    Dau_Cache_t * p = ABC_CALLOC( Dau_Cache_t, 1 );
+    p->pFileName = pFileName ? Abc_UtilStrsav( pFileName ) : NULL;
+    p->vJournal  = Vec_StrAlloc( 1 << 16 );
+    p->vTemp     = Vec_IntAlloc( 100 );
+    p->fVerbose  = fVerbose;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    Dau_CacheSync_int( p );
+    return p;
+}
+void Dau_CacheStop( Dau_Cache_t * p )
+{
+    int i;
+    Dau_CacheSync_int( p );
+    for ( i = 0; i <= DAU_MAX_VAR; i++ )
+    {
+        Vec_MemHashFree( p->vTtMems[i] );
+        Vec_MemFreeP( &p->vTtMems[i] );
+        Vec_WecFreeP( &p->vAigs[i] );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    Vec_StrFree( p->vJournal );
+    Vec_IntFree( p->vTemp );
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+}
+void Dau_CachePrintStats( Dau_Cache_t * p )
+{
+    int i, nAnds, nEntries;
+    printf( "Resynthesis cache" );
+    if ( p->pFileName )
+        printf( " with file \"%s\"", p->pFileName );
+    printf( ":\n" );
+    for ( i = 0; i <= DAU_MAX_VAR; i++ )
+    {
+        Vec_Int_t * vAig; int k;
+        if ( p->vAigs[i] == NULL )
+            continue;
+        nAnds = 0;
+        nEntries = Vec_WecSize(p->vAigs[i]);
+        Vec_WecForEachLevel( p->vAigs[i], vAig, k )
+            nAnds += Dau_CacheAigAndNum( vAig );
+        printf( "%2d inputs : Classes = %8d.  Ave ANDs = %6.2f.\n", i, nEntries, nEntries ? 1.0 * nAnds / nEntries : 0.0 );
+    }
+    printf( "Lookups = %d.  Hits = %d (%.2f %%).  New = %d.  Improved = %d.  Read = %d.  Written = %d.\n",
+        p->nLookups, p->nHits, p->nLookups ? 100.0 * p->nHits / p->nLookups : 0.0, p->nInserts, p->nImproved, p->nRead, p->nWritten );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up the best known structure of the function.]
+
+  Description [The function is given by its truth table (with nVars inputs).
+  If the NPN class of the function is in the cache, returns 1 and writes
+  into vAig the cached structure expressed in terms of the original inputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dau_CacheLookup( Dau_Cache_t * p, word * pTruth, int nVars, Vec_Int_t * vAig )
+{
+    word pCanon[DAU_MAX_WORD];
+    char pPerm[DAU_MAX_VAR];
+    unsigned uPhase;
+    int * pSpot, RetValue = 0;
+    if ( nVars < 1 || nVars > DAU_MAX_VAR )
+        return 0;
+    Abc_TtCopy( pCanon, pTruth, Abc_TtWordNum(nVars), 0 );
+    uPhase = Dau_CacheCanonicize( pCanon, nVars, pPerm );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    p->nLookups++;
+    if ( p->vTtMems[nVars] != NULL )
+    {
+        pSpot = Vec_MemHashLookup( p->vTtMems[nVars], pCanon );
+        if ( *pSpot != -1 )
+        {
+            Dau_CacheAigTransform( Vec_WecEntry(p->vAigs[nVars], *pSpot), nVars, pPerm, uPhase, 0, vAig );
+            p->nHits++;
+            RetValue = 1;
+        }
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records a structure of the function.]
+
+  Description [The structure in vAig is expressed in terms of the inputs
+  of the function. Returns 1 if it is better than the cached one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dau_CacheInsert( Dau_Cache_t * p, word * pTruth, int nVars, Vec_Int_t * vAig )
+{
+    word pCanon[DAU_MAX_WORD];
+    char pPerm[DAU_MAX_VAR];
+    unsigned uPhase;
+    int RetValue;
+    if ( nVars < 1 || nVars > DAU_MAX_VAR || !Dau_CacheAigCheck(vAig, nVars) )
+        return 0;
+    Abc_TtCopy( pCanon, pTruth, Abc_TtWordNum(nVars), 0 );
+    uPhase = Dau_CacheCanonicize( pCanon, nVars, pPerm );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    Dau_CacheAigTransform( vAig, nVars, pPerm, uPhase, 1, p->vTemp );
+    RetValue = Dau_CacheInsertCanon( p, pCanon, nVars, p->vTemp, 1 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The cache shared by the resynthesis commands.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dau_Cache_t * Dau_CacheReadGlobal()
+{
+    return s_pDauCache;
+}
+void Dau_CacheSetGlobal( Dau_Cache_t * p )
+{
+    if ( s_pDauCache && s_pDauCache != p )
+        Dau_CacheStop( s_pDauCache );
+    s_pDauCache = p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
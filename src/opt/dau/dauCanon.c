@@ -801,7 +801,7 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
 {
     if ( fSwapOnly )
     {
-        static word pCopy[1024];
+        static ABC_THREAD_LOCAL word pCopy[1024];
         Abc_TtCopy( pCopy, pTruth, nWords, 0 );
         Abc_TtSwapAdjacent( pCopy, nWords, i );
         if ( Abc_TtCompareRev(pTruth, pCopy, nWords) == 1 )
@@ -812,8 +812,8 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
         return 0;
     }
     {
-        static word pCopy[1024];
-        static word pBest[1024];
+        static ABC_THREAD_LOCAL word pCopy[1024];
+        static ABC_THREAD_LOCAL word pBest[1024];
         int Config = 0;
         // save two copies
         Abc_TtCopy( pCopy, pTruth, nWords, 0 );
@@ -992,7 +992,7 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
         return Config;
     }
     {
-        static word pCopy1[1024];
+        static ABC_THREAD_LOCAL word pCopy1[1024];
         int Config;
         Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
         Config = Abc_TtCofactorPermConfig( pTruth, i, nWords, 0, fNaive );
@@ -1042,8 +1042,8 @@ unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
 
 #ifdef CANON_VERIFY
     char pCanonPermCopy[16];
-    static word pCopy1[1024];
-    static word pCopy2[1024];
+    static ABC_THREAD_LOCAL word pCopy1[1024];
+    static ABC_THREAD_LOCAL word pCopy2[1024];
     Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
 #endif
 
@@ -1091,8 +1091,8 @@ unsigned Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm )
 
 #ifdef CANON_VERIFY
     char pCanonPermCopy[16];
-    static word pCopy1[1024];
-    static word pCopy2[1024];
+    static ABC_THREAD_LOCAL word pCopy1[1024];
+    static ABC_THREAD_LOCAL word pCopy2[1024];
     Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
 #endif
 
@@ -1192,8 +1192,8 @@ unsigned Abc_TtCanonicizePhase( word * pTruth, int nVars )
 //    Counter++;
 
 #ifdef CANON_VERIFY
-    static word pCopy1[1024];
-    static word pCopy2[1024];
+    static ABC_THREAD_LOCAL word pCopy1[1024];
+    static ABC_THREAD_LOCAL word pCopy2[1024];
     Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
 #endif
 
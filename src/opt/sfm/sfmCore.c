@@ -52,6 +52,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nThreads     =    1;  // the number of threads evaluating the nodes
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -96,6 +97,9 @@ void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
     ABC_PRTP( "Oth", p->timeOther,  p->timeTotal );
     ABC_PRTP( "ALL", p->timeTotal,  p->timeTotal );
 //    ABC_PRTP( "   ", p->time1    ,  p->timeTotal );
+    if ( p->timeParWin + p->timeParDiv + p->timeParCnf + p->timeParSat )
+        printf( "CPU time of the worker threads:  Win = %.2f sec  Div = %.2f sec  Cnf = %.2f sec  Sat = %.2f sec\n",
+            1.0*p->timeParWin/CLOCKS_PER_SEC, 1.0*p->timeParDiv/CLOCKS_PER_SEC, 1.0*p->timeParCnf/CLOCKS_PER_SEC, 1.0*p->timeParSat/CLOCKS_PER_SEC );
 }
 
 /**Function*************************************************************
@@ -214,6 +218,14 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the update to be performed by the caller
+    if ( p->fUpdDelay )
+    {
+        p->iUpdFanin    = f;
+        p->iUpdFaninNew = (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar));
+        p->uUpdTruth    = uTruth;
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth, p->pTruth );
     // the number of fanins cannot increase
@@ -280,6 +292,14 @@ p->timeSat += Abc_Clock() - clk;
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
+    // record the update to be performed by the caller
+    if ( p->fUpdDelay )
+    {
+        p->iUpdFanin    = -1;
+        p->iUpdFaninNew = -1;
+        p->uUpdTruth    = uTruth;
+        return 1;
+    }
     // update truth table
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
     Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
@@ -382,6 +402,9 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+    if ( pPars->nThreads > 1 )
+        Counter = Sfm_NtkPerformPar( p, &CounterLarge );
+    else
     Sfm_NtkForEachNode( p, i )
     {
         if ( Sfm_ObjIsFixed( p, i ) )
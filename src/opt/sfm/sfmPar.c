@@ -0,0 +1,522 @@
+/**CFile****************************************************************
+
+  FileName    [sfmPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based optimization using internal don't-cares.]
+
+  Synopsis    [Concurrent evaluation of the nodes.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "sfmInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SFM_PAR_MAX        64  // the max number of threads
+#define SFM_PAR_ROUND     256  // the max number of nodes evaluated before committing the changes
+#define SFM_PAR_ROUND_MIN   8  // the min number of nodes evaluated before committing the changes
+
+// the update proposed for one node
+typedef struct Sfm_ParUpd_t_ Sfm_ParUpd_t;
+struct Sfm_ParUpd_t_
+{
+    int               iNode;       // the node
+    int               fChange;     // the node can be improved
+    int               iFanin;      // the fanin index to replace (-1 if only the function changes)
+    int               iFaninNew;   // the new fanin (-1 if the fanin is removed)
+    word              uTruth;      // the new function
+    word              pTruth[SFM_WORDS_MAX]; // the new function
+    Vec_Int_t *       vSupp;       // the objects whose functions justify the update
+    Vec_Int_t *       vTfo;        // the TFO of the node in the window without the roots
+};
+
+// the state shared by the threads evaluating the nodes
+typedef struct Sfm_ParMan_t_ Sfm_ParMan_t;
+struct Sfm_ParMan_t_
+{
+    Sfm_Ntk_t *       pNtk;        // the network
+    Sfm_Ntk_t *       pWorkers[SFM_PAR_MAX]; // private copies of the network
+    int               iWorker;     // the next private copy to be taken
+    Sfm_ParUpd_t *    pUpds;       // the nodes evaluated in this round
+    int               nUpds;       // the number of nodes in this round
+    int               iNext;       // the next node to be evaluated
+    int               iRound;      // the current round
+    Vec_Int_t *       vMarks;      // the last round when the object has changed
+    Vec_Int_t *       vMffc;       // the nodes to be removed by the update
+    Vec_Int_t *       vRefs;       // the fanout counters used to find the MFFC
+    Vec_Int_t *       vVisited;    // the last traversal when the object was visited
+    int               nVisits;     // the number of traversals
+    int               fNewEdges;   // new fanins were added in this round
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t   Mutex;       // protects iWorker and iNext
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a private copy of the network for one thread.]
+
+  Description [The copy shares the network (fanins, fanouts, levels, truth
+  tables, CNFs) with the original, which is only read while the nodes are
+  evaluated. The traversal IDs, the SAT variable maps, the window, the SAT
+  solver and the parameters are private. The copy records the updates
+  instead of performing them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Sfm_Ntk_t * Sfm_ParStartWorker( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pNew = ABC_ALLOC( Sfm_Ntk_t, 1 );
+    int i;
+    memcpy( pNew, p, sizeof(Sfm_Ntk_t) );
+    pNew->pPars = ABC_ALLOC( Sfm_Par_t, 1 );
+    memcpy( pNew->pPars, p->pPars, sizeof(Sfm_Par_t) );
+    pNew->pPars->fVeryVerbose = 0;
+    // private traversal data
+    Vec_IntZero( &pNew->vCounts );
+    Vec_IntZero( &pNew->vTravIds );
+    Vec_IntZero( &pNew->vTravIds2 );
+    Vec_IntZero( &pNew->vId2Var );
+    Vec_IntZero( &pNew->vVar2Id );
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    pNew->nTravIds  = 0;
+    pNew->nTravIds2 = 0;
+    pNew->vCover    = Vec_IntAlloc( 1 << 16 );
+    for ( i = 0; i < SFM_FANIN_MAX; i++ )
+        pNew->pTtElems[i] = pNew->TtElems[i];
+    // statistics
+    pNew->nTryRemoves = pNew->nTryImproves = pNew->nTryResubs = 0;
+    pNew->nRemoves    = pNew->nImproves    = pNew->nResubs    = 0;
+    pNew->nNodesTried = pNew->nTotalDivs   = pNew->nSatCalls  = 0;
+    pNew->nTimeOuts   = pNew->nMaxDivs     = 0;
+    pNew->timeWin = pNew->timeDiv = pNew->timeCnf = pNew->timeSat = 0;
+    // window and SAT solver
+    Sfm_NtkPrepare( pNew );
+    pNew->nLevelMax = p->nLevelMax;
+    pNew->fUpdDelay = 1;
+    return pNew;
+}
+static void Sfm_ParStopWorker( Sfm_Ntk_t * p, Sfm_Ntk_t * pW )
+{
+    p->nTryRemoves  += pW->nTryRemoves;
+    p->nTryImproves += pW->nTryImproves;
+    p->nTryResubs   += pW->nTryResubs;
+    p->nRemoves     += pW->nRemoves;
+    p->nImproves    += pW->nImproves;
+    p->nResubs      += pW->nResubs;
+    p->nNodesTried  += pW->nNodesTried;
+    p->nTotalDivs   += pW->nTotalDivs;
+    p->nSatCalls    += pW->nSatCalls;
+    p->nTimeOuts    += pW->nTimeOuts;
+    p->nMaxDivs     += pW->nMaxDivs;
+    // the worker times overlap in wall-clock time, so they are reported separately
+    p->timeParWin   += pW->timeWin;
+    p->timeParDiv   += pW->timeDiv;
+    p->timeParCnf   += pW->timeCnf;
+    p->timeParSat   += pW->timeSat;
+    ABC_FREE( pW->vCounts.pArray );
+    ABC_FREE( pW->vTravIds.pArray );
+    ABC_FREE( pW->vTravIds2.pArray );
+    ABC_FREE( pW->vId2Var.pArray );
+    ABC_FREE( pW->vVar2Id.pArray );
+    Vec_IntFree( pW->vCover );
+    Vec_IntFreeP( &pW->vNodes );
+    Vec_IntFreeP( &pW->vDivs  );
+    Vec_IntFreeP( &pW->vRoots );
+    Vec_IntFreeP( &pW->vTfo   );
+    Vec_WrdFreeP( &pW->vDivCexes );
+    Vec_IntFreeP( &pW->vOrder );
+    Vec_IntFreeP( &pW->vDivVars );
+    Vec_IntFreeP( &pW->vDivIds );
+    Vec_IntFreeP( &pW->vLits  );
+    Vec_IntFreeP( &pW->vValues );
+    Vec_WecFreeP( &pW->vClauses );
+    Vec_IntFreeP( &pW->vFaninMap );
+    sat_solver_delete( pW->pSat );
+    ABC_FREE( pW->pPars );
+    ABC_FREE( pW );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates one node using the private copy of the network.]
+
+  Description [Records the update and the objects whose functions justify
+  it: the node, its fanins, the new fanin, the TFO of the node in the window
+  and the fanins of the TFO nodes. As long as these functions are the same,
+  the update remains valid, even if the other objects of the window change.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sfm_ParEvalNode( Sfm_Ntk_t * pW, Sfm_ParUpd_t * pUpd )
+{
+    int i, k, iObj, iFanin;
+    // skip the nodes removed in the previous rounds
+    pUpd->fChange = Sfm_ObjFanoutNum(pW, pUpd->iNode) > 0 && Sfm_NodeResub( pW, pUpd->iNode );
+    if ( !pUpd->fChange )
+        return;
+    pUpd->iFanin    = pW->iUpdFanin;
+    pUpd->iFaninNew = pW->iUpdFaninNew;
+    pUpd->uTruth    = pW->uUpdTruth;
+    memcpy( pUpd->pTruth, pW->pTruth, sizeof(word) * SFM_WORDS_MAX );
+    Vec_IntClear( pUpd->vSupp );
+    Vec_IntPush( pUpd->vSupp, pUpd->iNode );
+    Sfm_ObjForEachFanin( pW, pUpd->iNode, iFanin, k )
+        Vec_IntPush( pUpd->vSupp, iFanin );
+    if ( pUpd->iFaninNew >= 0 )
+        Vec_IntPush( pUpd->vSupp, pUpd->iFaninNew );
+    Vec_IntForEachEntry( pW->vTfo, iObj, i )
+    {
+        Vec_IntPush( pUpd->vSupp, iObj );
+        Sfm_ObjForEachFanin( pW, iObj, iFanin, k )
+            Vec_IntPush( pUpd->vSupp, iFanin );
+    }
+    Vec_IntClear( pUpd->vTfo );
+    Vec_IntForEachEntry( pW->vTfo, iObj, i )
+        if ( Vec_IntFind(pW->vRoots, iObj) == -1 )
+            Vec_IntPush( pUpd->vTfo, iObj );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the nodes of the round one at a time.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Sfm_ParWorkerThread( void * pArg )
+{
+    Sfm_ParMan_t * p = (Sfm_ParMan_t *)pArg;
+    Sfm_Ntk_t * pW;
+    int iUpd;
+    pthread_mutex_lock( &p->Mutex );
+    pW = p->pWorkers[p->iWorker++];
+    pthread_mutex_unlock( &p->Mutex );
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        iUpd = p->iNext < p->nUpds ? p->iNext++ : -1;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iUpd == -1 )
+            break;
+        Sfm_ParEvalNode( pW, p->pUpds + iUpd );
+    }
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node is in the TFI of the object.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_ParNodeIsInTfi_rec( Sfm_ParMan_t * p, int iObj, int iNode )
+{
+    int i, iFanin;
+    if ( iObj == iNode )
+        return 1;
+    if ( Vec_IntEntry(p->vVisited, iObj) == p->nVisits )
+        return 0;
+    Vec_IntWriteEntry( p->vVisited, iObj, p->nVisits );
+    if ( Sfm_ObjLevel(p->pNtk, iObj) < Sfm_ObjLevel(p->pNtk, iNode) )
+        return 0;
+    Sfm_ObjForEachFanin( p->pNtk, iObj, iFanin, i )
+        if ( Sfm_ParNodeIsInTfi_rec( p, iFanin, iNode ) )
+            return 1;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the nodes removed together with the fanin.]
+
+  Description [Dereferences the fanin using the private fanout counters,
+  without changing the network.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sfm_ParCollectMffc_rec( Sfm_ParMan_t * p, int iObj )
+{
+    int i, iFanin;
+    if ( Sfm_ObjIsPi(p->pNtk, iObj) || Sfm_ObjIsFixed(p->pNtk, iObj) )
+        return;
+    if ( Vec_IntEntry(p->vVisited, iObj) != p->nVisits )
+    {
+        Vec_IntWriteEntry( p->vVisited, iObj, p->nVisits );
+        Vec_IntWriteEntry( p->vRefs, iObj, Sfm_ObjFanoutNum(p->pNtk, iObj) );
+    }
+    if ( Vec_IntAddToEntry(p->vRefs, iObj, -1) > 0 )
+        return;
+    Vec_IntPush( p->vMffc, iObj );
+    Sfm_ObjForEachFanin( p->pNtk, iObj, iFanin, i )
+        Sfm_ParCollectMffc_rec( p, iFanin );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the update proposed for the node.]
+
+  Description [Returns 1 if the update was performed. Returns 0 if the
+  update is no longer justified because of the updates performed earlier
+  in this round, in which case the node should be evaluated again. Returns
+  -1 if the new fanin no longer satisfies the level constraint. An update
+  changes the functions of the node and of its TFO in the window (but not
+  of the window roots), changes the fanouts of the new fanin, and removes
+  the MFFC of the old fanin. These objects are marked. The other objects
+  keep their functions. Since the new fanins of the earlier updates may
+  have created new paths, the new fanin is also checked for loops.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_ParCommit( Sfm_ParMan_t * p, Sfm_ParUpd_t * pUpd )
+{
+    Sfm_Ntk_t * pNtk = p->pNtk;
+    int i, iObj, iNode = pUpd->iNode;
+    Vec_IntForEachEntry( pUpd->vSupp, iObj, i )
+        if ( Vec_IntEntry(p->vMarks, iObj) == p->iRound )
+            return 0;
+    if ( pUpd->iFaninNew >= 0 && p->fNewEdges )
+    {
+        p->nVisits++;
+        if ( Sfm_ParNodeIsInTfi_rec( p, pUpd->iFaninNew, iNode ) )
+            return 0;
+    }
+    if ( pUpd->iFaninNew >= 0 && Sfm_ObjLevel(pNtk, pUpd->iFaninNew) > pNtk->nLevelMax - Sfm_ObjLevelR(pNtk, iNode) )
+        return -1;
+    if ( pUpd->iFanin == -1 )
+    {
+        Vec_WrdWriteEntry( pNtk->vTruths, iNode, pUpd->uTruth );
+        Sfm_TruthToCnf( pUpd->uTruth, NULL, Sfm_ObjFaninNum(pNtk, iNode), pNtk->vCover, (Vec_Str_t *)Vec_WecEntry(pNtk->vCnfs, iNode) );
+    }
+    else
+    {
+        int nWords = Abc_Truth6WordNum( Sfm_ObjFaninNum(pNtk, iNode) - (int)(pUpd->iFaninNew == -1) );
+        // a constant node loses all fanins, otherwise one fanin is replaced
+        Vec_IntClear( p->vMffc );
+        p->nVisits++;
+        if ( Abc_TtIsConst0(pUpd->pTruth, nWords) || Abc_TtIsConst1(pUpd->pTruth, nWords) )
+        {
+            Sfm_ObjForEachFanin( pNtk, iNode, iObj, i )
+                Sfm_ParCollectMffc_rec( p, iObj );
+        }
+        else
+            Sfm_ParCollectMffc_rec( p, Sfm_ObjFanin(pNtk, iNode, pUpd->iFanin) );
+        Sfm_NtkUpdate( pNtk, iNode, pUpd->iFanin, pUpd->iFaninNew, pUpd->uTruth, pUpd->pTruth );
+        Vec_IntForEachEntry( p->vMffc, iObj, i )
+            Vec_IntWriteEntry( p->vMarks, iObj, p->iRound );
+        if ( pUpd->iFaninNew >= 0 )
+            Vec_IntWriteEntry( p->vMarks, pUpd->iFaninNew, p->iRound );
+        p->fNewEdges |= (pUpd->iFaninNew >= 0);
+    }
+    Vec_IntWriteEntry( p->vMarks, iNode, p->iRound );
+    Vec_IntForEachEntry( pUpd->vTfo, iObj, i )
+        Vec_IntWriteEntry( p->vMarks, iObj, p->iRound );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs MFS using several threads.]
+
+  Description [The nodes are processed in rounds. In each round, the nodes
+  are evaluated by the threads against the same network, each thread using
+  a private window and SAT solver. Then the updates are performed in the
+  node order, skipping those no longer justified after the earlier updates
+  of the round. The improved nodes and the skipped nodes are evaluated
+  again in the following rounds. When many updates are skipped, the rounds
+  become shorter, down to SFM_PAR_ROUND_MIN nodes. The round sizes and the
+  result do not depend on the number of threads. Returns the number of
+  improved nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar( Sfm_Ntk_t * pNtk, int * pCounterLarge )
+{
+    Sfm_ParMan_t Man, * p = &Man;
+    Sfm_Par_t * pPars = pNtk->pPars;
+    Vec_Int_t * vRetry = Vec_IntAlloc( SFM_PAR_ROUND );
+    Vec_Str_t * vImproved = Vec_StrStart( pNtk->nObjs );
+    int i, nTake, iNext = pNtk->nPis, RetValue, nThreads, Counter = 0;
+    int nRound = SFM_PAR_ROUND, nSkipped;
+    memset( p, 0, sizeof(Sfm_ParMan_t) );
+    p->pNtk     = pNtk;
+    p->pUpds    = ABC_CALLOC( Sfm_ParUpd_t, SFM_PAR_ROUND );
+    for ( i = 0; i < SFM_PAR_ROUND; i++ )
+    {
+        p->pUpds[i].vSupp = Vec_IntAlloc( 100 );
+        p->pUpds[i].vTfo  = Vec_IntAlloc( 100 );
+    }
+    p->vMarks   = Vec_IntStartFull( pNtk->nObjs );
+    p->vMffc    = Vec_IntAlloc( 100 );
+    p->vRefs    = Vec_IntStart( pNtk->nObjs );
+    p->vVisited = Vec_IntStartFull( pNtk->nObjs );
+    nThreads    = Abc_MaxInt( 1, Abc_MinInt( pPars->nThreads, SFM_PAR_MAX ) );
+    for ( i = 0; i < nThreads; i++ )
+        p->pWorkers[i] = Sfm_ParStartWorker( pNtk );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    for ( p->iRound = 0; ; p->iRound++ )
+    {
+        // take the nodes to be evaluated again, then the new nodes
+        p->nUpds = 0;
+        nTake = Abc_MinInt( nRound, Vec_IntSize(vRetry) );
+        for ( i = 0; i < nTake; i++ )
+            p->pUpds[p->nUpds++].iNode = Vec_IntEntry( vRetry, i );
+        for ( i = nTake; i < Vec_IntSize(vRetry); i++ )
+            Vec_IntWriteEntry( vRetry, i - nTake, Vec_IntEntry(vRetry, i) );
+        Vec_IntShrink( vRetry, Vec_IntSize(vRetry) - nTake );
+        for ( ; p->nUpds < nRound && iNext + pNtk->nPos < pNtk->nObjs; iNext++ )
+        {
+            if ( Sfm_ObjIsFixed( pNtk, iNext ) )
+                continue;
+            if ( pPars->nDepthMax && Sfm_ObjLevel(pNtk, iNext) > pPars->nDepthMax )
+                continue;
+            if ( Sfm_ObjFaninNum(pNtk, iNext) > SFM_SUPP_MAX )
+            {
+                (*pCounterLarge)++;
+                continue;
+            }
+            p->pUpds[p->nUpds++].iNode = iNext;
+        }
+        if ( p->nUpds == 0 )
+            break;
+        // evaluate the nodes
+        p->iNext = 0;
+        p->iWorker = 0;
+        p->fNewEdges = 0;
+#ifdef ABC_USE_PTHREADS
+        if ( nThreads > 1 )
+        {
+            pthread_t WorkerThread[SFM_PAR_MAX];
+            int status, nRun = Abc_MinInt( nThreads, p->nUpds );
+            for ( i = 0; i < nRun; i++ )
+            {
+                status = pthread_create( WorkerThread + i, NULL, Sfm_ParWorkerThread, (void *)p );  assert( status == 0 );
+            }
+            for ( i = 0; i < nRun; i++ )
+            {
+                status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+            }
+        }
+        else
+#endif
+        for ( i = 0; i < p->nUpds; i++ )
+            Sfm_ParEvalNode( p->pWorkers[0], p->pUpds + i );
+        // perform the updates in the node order
+        nSkipped = 0;
+        for ( i = 0; i < p->nUpds; i++ )
+        {
+            Sfm_ParUpd_t * pUpd = p->pUpds + i;
+            if ( !pUpd->fChange )
+                continue;
+            RetValue = Sfm_ParCommit( p, pUpd );
+            if ( RetValue == 1 )
+            {
+                Counter += !Vec_StrEntry( vImproved, pUpd->iNode );
+                Vec_StrWriteEntry( vImproved, pUpd->iNode, 1 );
+            }
+            else if ( pUpd->iFanin == -1 )
+                pNtk->nImproves--;
+            else if ( pUpd->iFaninNew == -1 )
+                pNtk->nRemoves--;
+            else
+                pNtk->nResubs--;
+            if ( RetValue >= 0 )
+                Vec_IntPush( vRetry, pUpd->iNode );
+            nSkipped += (RetValue == 0);
+        }
+        Vec_IntSort( vRetry, 0 );
+        nRound = Abc_MinInt( SFM_PAR_ROUND, Abc_MaxInt(SFM_PAR_ROUND_MIN, 2 * (p->nUpds - nSkipped)) );
+        if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+            break;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    for ( i = 0; i < nThreads; i++ )
+        Sfm_ParStopWorker( pNtk, p->pWorkers[i] );
+    for ( i = 0; i < SFM_PAR_ROUND; i++ )
+    {
+        Vec_IntFree( p->pUpds[i].vSupp );
+        Vec_IntFree( p->pUpds[i].vTfo );
+    }
+    ABC_FREE( p->pUpds );
+    Vec_IntFree( p->vMarks );
+    Vec_IntFree( p->vMffc );
+    Vec_IntFree( p->vRefs );
+    Vec_IntFree( p->vVisited );
+    Vec_IntFree( vRetry );
+    Vec_StrFree( vImproved );
+    return Counter;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
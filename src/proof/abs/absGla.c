@@ -1806,13 +1806,12 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                 // call the prover
                 if ( p->pPars->fCallProver )
                 {
-                    // cancel old one if it is proving
-                    if ( iFrameTryToProve >= 0 )
-                        Gia_GlaProveCancel( pPars->fVerbose );
-                    // prove new one
-                    Gia_GlaProveAbsracted( pAig, pPars->fSimpProver, pPars->fVeryVerbose );
-                    iFrameTryToProve = f;
-                    p->nPdrCalls++;
+                    // prove new one (this cancels the old one unless it is the same abstraction)
+                    if ( Gia_GlaProveAbsracted( pAig, pPars->fSimpProver, pPars->nProvers, pPars->fVeryVerbose ) )
+                    {
+                        iFrameTryToProve = f;
+                        p->nPdrCalls++;
+                    }
                 }
                 // speak to the bridge
                 if ( Abc_FrameIsBridgeMode() )
@@ -1839,8 +1838,8 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     }
 finish:
     Prf_ManStopP( &p->pSat->pPrf2 );
-    // cancel old one if it is proving
-    if ( iFrameTryToProve >= 0 )
+    // cancel old one if it is proving and forget the last abstraction
+    if ( p->pPars->fCallProver )
         Gia_GlaProveCancel( pPars->fVerbose );
     // analize the results
     if ( !p->fUseNewLine )
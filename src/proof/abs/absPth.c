@@ -21,6 +21,9 @@
 #include "abs.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "proof/int/int.h"
+#include "sat/bmc/bmc.h"
+#include "bdd/bbr/bbr.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -42,27 +45,43 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
-void Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose ) {}
+int  Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int nProvers, int fVerbose ) { return 0; }
 void Gia_GlaProveCancel( int fVerbose )                                    {}
 int  Gia_GlaProveCheck( int fVerbose )                                     { return 0; }
 
 #else // pthreads are used
 
+// prover engines in the order they are added to the pool
+#define ABS_ENGINE_PDR  0
+#define ABS_ENGINE_BMC  1
+#define ABS_ENGINE_INT  2
+#define ABS_ENGINE_BDD  3
+#define ABS_ENGINE_MAX  4
+static char * s_pEngineNames[ABS_ENGINE_MAX] = { "PDR", "BMC", "INT", "BDD" };
+
 // information given to the thread
 typedef struct Abs_ThData_t_
 {
     Aig_Man_t * pAig;
     int         fVerbose;
     int         RunId;
+    int         iEngine;
 } Abs_ThData_t;
 
 // mutext to control access to shared variables
 pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+// mutexes serializing the engines that rely on process-wide state
+// (interpolation uses the static CNF manager of Cnf_Derive; CUDD has static tables)
+static pthread_mutex_t g_mutexInt = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t g_mutexBdd = PTHREAD_MUTEX_INITIALIZER;
 static volatile int g_nRunIds = 0;             // the number of the last prover instance
+static volatile int g_nRunIdMin = 0;           // the instances below this number are cancelled
 static volatile int g_fAbstractionProved = 0;  // set to 1 when prover successed to prove
+static Vec_Int_t *  g_vAbsLast = NULL;         // the gate classes of the last abstraction sent to the pool
+static volatile int g_fAbsLastDisproved = 0;   // set to 1 when the last abstraction has a counter-example
 
-// call back procedure for PDR
-int Abs_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIds; }
+// call back procedure for the provers
+int Abs_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIdMin; }
 
 // test procedure to replace PDR
 int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
@@ -81,6 +100,73 @@ int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Runs one prover engine on the abstraction.]
+
+  Description [Returns 1 if proved, 0 if disproved, -1 if undecided.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abs_ProverRunEngine( Abs_ThData_t * pThData )
+{
+    Aig_Man_t * pAig = pThData->pAig;
+    int RetValue = -1, iFrame = -1, status;
+    if ( pThData->iEngine == ABS_ENGINE_PDR )
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->fSilent   = 1;
+        pPars->RunId     = pThData->RunId;
+        pPars->pFuncStop = Abs_CallBackToStop;
+        RetValue = Pdr_ManSolve( pAig, pPars );
+    }
+    else if ( pThData->iEngine == ABS_ENGINE_BMC )
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->fSilent   = 1;
+        pPars->RunId     = pThData->RunId;
+        pPars->pFuncStop = Abs_CallBackToStop;
+        RetValue = Saig_ManBmcScalable( pAig, pPars );
+        // BMC cannot prove the property, only disprove it
+        if ( RetValue == 1 )
+            RetValue = -1;
+    }
+    else if ( pThData->iEngine == ABS_ENGINE_INT )
+    {
+        Inter_ManParams_t Pars, * pPars = &Pars;
+        if ( Saig_ManRegNum(pAig) == 0 || Saig_ManPiNum(pAig) == 0 || Saig_ManPoNum(pAig) != 1 )
+            return -1;
+        Inter_ManSetDefaultParams( pPars );
+        pPars->RunId     = pThData->RunId;
+        pPars->pFuncStop = Abs_CallBackToStop;
+        status = pthread_mutex_lock(&g_mutexInt);  assert( status == 0 );
+        if ( !Abs_CallBackToStop(pThData->RunId) )
+            RetValue = Inter_ManPerformInterpolation( pAig, pPars, &iFrame );
+        status = pthread_mutex_unlock(&g_mutexInt);  assert( status == 0 );
+    }
+    else if ( pThData->iEngine == ABS_ENGINE_BDD )
+    {
+        Saig_ParBbr_t Pars, * pPars = &Pars;
+        if ( Saig_ManRegNum(pAig) == 0 )
+            return -1;
+        Bbr_ManSetDefaultParams( pPars );
+        pPars->fSilent   = 1;
+        pPars->RunId     = pThData->RunId;
+        pPars->pFuncStop = Abs_CallBackToStop;
+        status = pthread_mutex_lock(&g_mutexBdd);  assert( status == 0 );
+        if ( !Abs_CallBackToStop(pThData->RunId) )
+            RetValue = Aig_ManVerifyUsingBdds( pAig, pPars );
+        status = pthread_mutex_unlock(&g_mutexBdd);  assert( status == 0 );
+    }
+    else assert( 0 );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Create one thread]
@@ -95,30 +181,34 @@ int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 void * Abs_ProverThread( void * pArg )
 {
     Abs_ThData_t * pThData = (Abs_ThData_t *)pArg;
-    Pdr_Par_t Pars, * pPars = &Pars;
-    int RetValue, status;
-    // call PDR
-    Pdr_ManSetDefaultParams( pPars );
-    pPars->fSilent   = 1;
-    pPars->RunId     = pThData->RunId;
-    pPars->pFuncStop = Abs_CallBackToStop;
-    RetValue = Pdr_ManSolve( pThData->pAig, pPars );
+    int RetValue, status, fCancelled;
+    // call the engine
+    RetValue = Abs_ProverRunEngine( pThData );
     // update the result
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    // the engine was stopped if its abstraction became obsolete while it ran
+    fCancelled = (RetValue == -1 && pThData->RunId < g_nRunIdMin);
     if ( RetValue == 1 )
-    {
-        status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
         g_fAbstractionProved = 1;
-        status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    if ( RetValue != -1 && pThData->RunId >= g_nRunIdMin )
+    {
+        // the abstraction is decided, so its other engines can stop
+        g_nRunIdMin = pThData->RunId + 1;
+        if ( RetValue == 0 && pThData->RunId == g_nRunIds )
+            g_fAbsLastDisproved = 1;
     }
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
     // quit this thread
     if ( pThData->fVerbose )
     {
         if ( RetValue == 1 )
-            Abc_Print( 1, "Proved abstraction %d.\n", pThData->RunId );
+            Abc_Print( 1, "Proved abstraction %d by %s.\n", pThData->RunId, s_pEngineNames[pThData->iEngine] );
         else if ( RetValue == 0 )
-            Abc_Print( 1, "Disproved abstraction %d.\n", pThData->RunId );
+            Abc_Print( 1, "Disproved abstraction %d by %s.\n", pThData->RunId, s_pEngineNames[pThData->iEngine] );
+        else if ( fCancelled )
+            Abc_Print( 1, "Cancelled abstraction %d in %s.\n", pThData->RunId, s_pEngineNames[pThData->iEngine] );
         else if ( RetValue == -1 )
-            Abc_Print( 1, "Cancelled abstraction %d.\n", pThData->RunId );
+            Abc_Print( 1, "Undecided abstraction %d in %s (resource limit).\n", pThData->RunId, s_pEngineNames[pThData->iEngine] );
         else assert( 0 );
     }
     // free memory
@@ -129,7 +219,47 @@ void * Abs_ProverThread( void * pArg )
     assert(0);
     return NULL;
 }
-void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the two abstractions are the same.]
+
+  Description [Compares the flop sets first, because abstractions
+  that differ usually differ in the flops.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abs_GlaSameAbstraction( Gia_Man_t * p, Vec_Int_t * vAbs1, Vec_Int_t * vAbs2 )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    if ( Vec_IntSize(vAbs1) != Vec_IntSize(vAbs2) )
+        return 0;
+    Gia_ManForEachRo( p, pObj, i )
+        if ( Vec_IntEntry(vAbs1, Gia_ObjId(p, pObj)) != Vec_IntEntry(vAbs2, Gia_ObjId(p, pObj)) )
+            return 0;
+    return Vec_IntEqual( vAbs1, vAbs2 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sends the current abstraction to the prover pool.]
+
+  Description [Starts nProvers engines (PDR, BMC, interpolation, BDD
+  reachability) on the abstraction. The abstraction is skipped if it is
+  the same as the last one and that one is still being proved or has
+  been disproved. Otherwise, the engines working on older abstractions
+  are cancelled. Returns 1 if the abstraction was sent to the pool.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int nProvers, int fVerbose )
 {
     extern Aig_Man_t * Dar_ManRwsat( Aig_Man_t * pAig, int fBalance, int fVerbose );
     Abs_ThData_t * pThData;
@@ -137,11 +267,28 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     Aig_Man_t * pAig, * pTemp;
     Gia_Man_t * pAbs;
     pthread_t ProverThread;
-    int status;
+    int i, RunId, status;
     // disable verbosity
 //    fVerbose = 0;
-    // create abstraction 
     assert( pGia->vGateClasses != NULL );
+    nProvers = Abc_MinInt( Abc_MaxInt(nProvers, 1), ABS_ENGINE_MAX );
+    // skip the abstraction if it is already known
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    if ( g_vAbsLast && (g_nRunIds >= g_nRunIdMin || g_fAbsLastDisproved) && Abs_GlaSameAbstraction(pGia, g_vAbsLast, pGia->vGateClasses) )
+    {
+        if ( fVerbose )  Abc_Print( 1, "\nAbstraction %d is %s.\n", g_nRunIds, g_fAbsLastDisproved ? "disproved" : "still being proved" );
+        status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+        return 0;
+    }
+    // cancel the old abstractions and remember the new one
+    RunId = ++g_nRunIds;
+    g_nRunIdMin = RunId;
+    g_fAbstractionProved = 0;
+    g_fAbsLastDisproved = 0;
+    Vec_IntFreeP( &g_vAbsLast );
+    g_vAbsLast = Vec_IntDup( pGia->vGateClasses );
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    // create abstraction 
     pAbs = Gia_ManDupAbsGates( pGia, pGia->vGateClasses );
     Gia_ManCleanValue( pGia );
     pAig = Gia_ManToAigSimple( pAbs );
@@ -160,27 +307,28 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     // synthesize abstraction
 //    pAig = Dar_ManRwsat( pTemp = pAig, 0, 0 ); 
 //    Aig_ManStop( pTemp );
-    // reset the proof 
-    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
-    g_fAbstractionProved = 0;
-    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
-    // collect thread data
-    pThData = ABC_CALLOC( Abs_ThData_t, 1 );
-    pThData->pAig = pAig;
-    pThData->fVerbose = fVerbose;
-    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
-    pThData->RunId = ++g_nRunIds;
-    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
-    // create thread
-    if ( fVerbose )  Abc_Print( 1, "\nTrying to prove abstraction %d.\n", pThData->RunId );
-    status = pthread_create( &ProverThread, NULL, Abs_ProverThread, pThData );
-    assert( status == 0 );
+    if ( fVerbose )  Abc_Print( 1, "\nTrying to prove abstraction %d using %d engine%s.\n", RunId, nProvers, nProvers > 1 ? "s" : "" );
+    // create threads, each working on its own copy of the abstraction
+    for ( i = 0; i < nProvers; i++ )
+    {
+        pThData = ABC_CALLOC( Abs_ThData_t, 1 );
+        pThData->pAig     = (i < nProvers - 1) ? Aig_ManDupSimple( pAig ) : pAig;
+        pThData->fVerbose = fVerbose;
+        pThData->RunId    = RunId;
+        pThData->iEngine  = i;
+        status = pthread_create( &ProverThread, NULL, Abs_ProverThread, pThData );
+        assert( status == 0 );
+        status = pthread_detach( ProverThread );
+        assert( status == 0 );
+    }
+    return 1;
 }
 void Gia_GlaProveCancel( int fVerbose )
 {
     int status;
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
-    g_nRunIds++;
+    g_nRunIdMin = g_nRunIds + 1;
+    Vec_IntFreeP( &g_vAbsLast );
     status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
 }
 int Gia_GlaProveCheck( int fVerbose )
@@ -22,12 +22,33 @@
 #include "misc/vec/vecWec.h"
 #include "misc/vec/vecHsh.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define ACEC_PAR_MAX  64    // the largest number of threads
+#define ACEC_PAR_MIN 256    // the smallest number of monomials rewritten by the threads
+
+typedef struct Gia_PolynPar_t_ Gia_PolynPar_t;
+typedef struct Gia_PolynThData_t_
+{
+    Gia_PolynPar_t * p;
+    int              iThread;
+} Gia_PolynThData_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -636,10 +657,270 @@ static inline void Gia_PolynPrepare4( Vec_Int_t * vTempC[4], Vec_Int_t * vTempM[
     Vec_IntPushUniqueOrder( vTempM[3], iFan1 );
 }
 
-Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, int fSigned, int fVerbose, int fVeryVerbose )
+/**Function*************************************************************
+
+  Synopsis    [Derives the terms replacing one monomial.]
+
+  Description [The monomial vMono with the coefficient vConst contains
+  node iObj, which is replaced by its fanins. The resulting terms are
+  appended to vTerms in the same order in which Gia_PolynBuildNew()
+  adds them, each as the coefficient followed by the monomial, both
+  preceded by their size. The record of the monomial starts with the
+  increment of the build counter and the number of terms.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_PolynPushTerm( Vec_Int_t * vTerms, Vec_Int_t * vTempC, Vec_Int_t * vTempM )
+{
+    Vec_IntPush( vTerms, Vec_IntSize(vTempC) );
+    Vec_IntAppend( vTerms, vTempC );
+    Vec_IntPush( vTerms, Vec_IntSize(vTempM) );
+    Vec_IntAppend( vTerms, vTempM );
+}
+void Gia_PolynCollectTerms( Gia_Man_t * pGia, int iObj, Vec_Int_t * vConst, Vec_Int_t * vMono, Vec_Int_t * vTempC[4], Vec_Int_t * vTempM[4], Vec_Int_t * vTerms )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( pGia, iObj );
+    Gia_PolynPrepare4( vTempC, vTempM, vConst, vMono, iObj, Gia_ObjFaninId0(pObj, iObj), Gia_ObjFaninId1(pObj, iObj) );
+    if ( Gia_ObjIsXor(pObj) )
+        Vec_IntPushTwo( vTerms, 1, 0 );
+    else if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )  //  C * (1 - x) * (1 - y)
+    {
+        Vec_IntPushTwo( vTerms, 4, 4 );
+        Gia_PolynPushTerm( vTerms, vTempC[0], vTempM[0] );   //  C * 1
+        Gia_PolynPushTerm( vTerms, vTempC[1], vTempM[1] );   // -C * x
+        Gia_PolynPushTerm( vTerms, vTempC[3], vTempM[2] );   // -C * y 
+        Gia_PolynPushTerm( vTerms, vTempC[2], vTempM[3] );   //  C * x * y
+    }
+    else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) ) //  C * (1 - x) * y
+    {
+        Vec_IntPushTwo( vTerms, 3, 2 );
+        Gia_PolynPushTerm( vTerms, vTempC[0], vTempM[2] );   //  C * y 
+        Gia_PolynPushTerm( vTerms, vTempC[1], vTempM[3] );   // -C * x * y
+    }
+    else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) ) //  C * x * (1 - y)
+    {
+        Vec_IntPushTwo( vTerms, 2, 2 );
+        Gia_PolynPushTerm( vTerms, vTempC[0], vTempM[1] );   //  C * x 
+        Gia_PolynPushTerm( vTerms, vTempC[1], vTempM[3] );   // -C * x * y
+    }
+    else   
+    {
+        Vec_IntPushTwo( vTerms, 1, 1 );
+        Gia_PolynPushTerm( vTerms, vTempC[0], vTempM[3] );   //  C * x * y
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the monomials of one node using threads.]
+
+  Description [The monomials containing the node are split into equal
+  ranges, and each thread derives the terms for its range, reading the
+  hash tables, which do not change until all threads are done. The terms 
+  are then added by the calling thread range by range, in the same order 
+  as in the single-threaded computation, so the result is the same.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+struct Gia_PolynPar_t_
+{
+    Gia_Man_t *     pGia;         // the AIG
+    Hsh_VecMan_t *  pHashC;       // hash table for constants
+    Hsh_VecMan_t *  pHashM;       // hash table for monomials
+    Vec_Int_t *     vCoefs;       // monomial coefficients
+    Vec_Int_t *     vMonos;       // the monomials of the current node
+    int             iObj;         // the current node
+    int             nThreads;     // the number of threads (including the calling one)
+    Vec_Int_t *     vTemps[ACEC_PAR_MAX][8]; // temporary arrays of each thread
+    Vec_Int_t *     vTerms[ACEC_PAR_MAX];    // the terms derived by each thread
+#ifdef ABC_USE_PTHREADS
+    Gia_PolynThData_t ThData[ACEC_PAR_MAX];  // the data given to each thread
+    int             iRound;       // the number of nodes given to the threads
+    int             nDone;        // the number of threads done with the current node
+    int             fStop;        // the threads should exit
+    pthread_t       Threads[ACEC_PAR_MAX];
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondWork;
+    pthread_cond_t  CondDone;
+#endif
+};
+static inline void Gia_PolynReadEntry( Hsh_VecMan_t * p, int i, Vec_Int_t * vRes )
+{
+    // unlike Hsh_VecReadEntry(), does not write into the hash table
+    Hsh_VecObj_t * pObj = Hsh_VecObj( p, i );
+    vRes->nSize = vRes->nCap = pObj->nSize;
+    vRes->pArray = pObj->pArray;
+}
+void Gia_PolynCollectRange( Gia_PolynPar_t * p, int iThread )
+{
+    Vec_Int_t vConst, vMono, * vTerms = p->vTerms[iThread];
+    int k, iMono, nMonos = Vec_IntSize(p->vMonos);
+    int kStart = (int)((word)nMonos * iThread / p->nThreads);
+    int kStop  = (int)((word)nMonos * (iThread + 1) / p->nThreads);
+    Vec_IntClear( vTerms );
+    for ( k = kStart; k < kStop; k++ )
+    {
+        iMono = Vec_IntEntry( p->vMonos, k );
+        Gia_PolynReadEntry( p->pHashC, Vec_IntEntry(p->vCoefs, iMono), &vConst );
+        Gia_PolynReadEntry( p->pHashM, iMono, &vMono );
+        Gia_PolynCollectTerms( p->pGia, p->iObj, &vConst, &vMono, p->vTemps[iThread], p->vTemps[iThread] + 4, vTerms );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+
+void * Gia_PolynWorkerThread( void * pArg )
+{
+    Gia_PolynThData_t * pThData = (Gia_PolynThData_t *)pArg;
+    Gia_PolynPar_t * p = pThData->p;
+    int iRound = 0;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->iRound == iRound && !p->fStop )
+            pthread_cond_wait( &p->CondWork, &p->Mutex );
+        iRound = p->iRound;
+        if ( p->fStop )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            break;
+        }
+        pthread_mutex_unlock( &p->Mutex );
+        Gia_PolynCollectRange( p, pThData->iThread );
+        pthread_mutex_lock( &p->Mutex );
+        if ( ++p->nDone == p->nThreads - 1 )
+            pthread_cond_signal( &p->CondDone );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return NULL;
+}
+
+#endif // pthreads are used
+
+Gia_PolynPar_t * Gia_PolynParStart( Gia_Man_t * pGia, Hsh_VecMan_t * pHashC, Hsh_VecMan_t * pHashM, Vec_Int_t * vCoefs, int nThreads )
+{
+    Gia_PolynPar_t * p;
+    int i, k;
+    nThreads = Abc_MinInt( nThreads, ACEC_PAR_MAX );
+#ifndef ABC_USE_PTHREADS
+    nThreads = 1;
+#endif
+    if ( nThreads < 2 )
+        return NULL;
+    p = ABC_CALLOC( Gia_PolynPar_t, 1 );
+    p->pGia     = pGia;
+    p->pHashC   = pHashC;
+    p->pHashM   = pHashM;
+    p->vCoefs   = vCoefs;
+    p->vMonos   = Vec_IntAlloc( 1000 );
+    p->nThreads = nThreads;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        for ( k = 0; k < 8; k++ )
+            p->vTemps[i][k] = Vec_IntAlloc( 10 );
+        p->vTerms[i] = Vec_IntAlloc( 1000 );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->CondWork, NULL );
+    pthread_cond_init( &p->CondDone, NULL );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        int status;
+        p->ThData[i].p = p;
+        p->ThData[i].iThread = i;
+        status = pthread_create( p->Threads + i, NULL, Gia_PolynWorkerThread, (void *)(p->ThData + i) );  assert( status == 0 );
+    }
+#endif
+    return p;
+}
+void Gia_PolynParStop( Gia_PolynPar_t * p )
+{
+    int i, k;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->CondWork );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 1; i < p->nThreads; i++ )
+        pthread_join( p->Threads[i], NULL );
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->CondWork );
+    pthread_cond_destroy( &p->CondDone );
+#endif
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        for ( k = 0; k < 8; k++ )
+            Vec_IntFree( p->vTemps[i][k] );
+        Vec_IntFree( p->vTerms[i] );
+    }
+    Vec_IntFree( p->vMonos );
+    ABC_FREE( p );
+}
+int Gia_PolynParRewrite( Gia_PolynPar_t * p, Vec_Wec_t * vLit2Mono, int iObj, int * pnBuilds )
+{
+    Vec_Int_t * vArray = Vec_WecEntry( vLit2Mono, iObj );
+    Vec_Int_t * vTempC = p->vTemps[0][0], * vTempM = p->vTemps[0][4];
+    int i, k, t, n, iMono, nTerms, nMonos = 0;
+    // collect the monomials with non-zero coefficients
+    Vec_IntClear( p->vMonos );
+    Vec_IntForEachEntry( vArray, iMono, k )
+        if ( Vec_IntEntry(p->vCoefs, iMono) > 0 )
+            Vec_IntPush( p->vMonos, iMono );
+    p->iObj = iObj;
+    // derive the terms
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+    p->nDone = 0;
+    p->iRound++;
+    pthread_cond_broadcast( &p->CondWork );
+    pthread_mutex_unlock( &p->Mutex );
+    Gia_PolynCollectRange( p, 0 );
+    pthread_mutex_lock( &p->Mutex );
+    while ( p->nDone < p->nThreads - 1 )
+        pthread_cond_wait( &p->CondDone, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+#else
+    Gia_PolynCollectRange( p, 0 );
+#endif
+    // add the terms in the original order
+    for ( t = 0; t < p->nThreads; t++ )
+    {
+        int * pTerms = Vec_IntArray( p->vTerms[t] );
+        int * pStop  = pTerms + Vec_IntSize( p->vTerms[t] );
+        while ( pTerms < pStop )
+        {
+            *pnBuilds += *pTerms++;
+            nTerms = *pTerms++;
+            for ( i = 0; i < nTerms; i++ )
+            {
+                Vec_IntClear( vTempC );
+                for ( n = *pTerms++; n > 0; n-- )
+                    Vec_IntPush( vTempC, *pTerms++ );
+                Vec_IntClear( vTempM );
+                for ( n = *pTerms++; n > 0; n-- )
+                    Vec_IntPush( vTempM, *pTerms++ );
+                nMonos += Gia_PolynBuildAdd( p->pHashC, p->pHashM, p->vCoefs, vLit2Mono, vTempC, vTempM );
+            }
+        }
+    }
+    // the new terms do not contain the node, so the old monomials can be removed now
+    Vec_IntForEachEntry( p->vMonos, iMono, k )
+        Vec_IntWriteEntry( p->vCoefs, iMono, 0 );
+    return nMonos - Vec_IntSize(p->vMonos);
+}
+
+Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, int fSigned, int nThreads, int nMonoMax, int fVerbose, int fVeryVerbose )
 {
     abctime clk = Abc_Clock();
-    Vec_Wec_t * vPolyn;
+    Gia_PolynPar_t * pPar;
+    Vec_Wec_t * vPolyn = NULL;
     Vec_Wec_t * vLit2Mono = Vec_WecStart( Gia_ManObjNum(pGia) ); // mapping AIG literals into monomials
     Hsh_VecMan_t * pHashC = Hsh_VecManStart( 1000 );    // hash table for constants
     Hsh_VecMan_t * pHashM = Hsh_VecManStart( 1000 );    // hash table for monomials
@@ -730,10 +1011,21 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
     }
 
     // perform construction for internal nodes
+    pPar = Gia_PolynParStart( pGia, pHashC, pHashM, vCoefs, nThreads );
     Vec_IntForEachEntryReverse( vNodes, iObj, i )
     {
         Gia_Obj_t * pObj = Gia_ManObj( pGia, iObj );
         Vec_Int_t * vArray = Vec_WecEntry( vLit2Mono, iObj );
+        if ( nMonoMax && Hsh_VecSize(pHashM) > nMonoMax )
+        {
+            printf( "The number of monomials exceeded the limit (%d) with %d nodes left.  ", nMonoMax, i+1 );
+            break;
+        }
+        if ( pPar && Vec_IntSize(vArray) >= ACEC_PAR_MIN )
+        {
+            nMonos += Gia_PolynParRewrite( pPar, vLit2Mono, iObj, &nBuilds );
+            continue;
+        }
         Vec_IntForEachEntry( vArray, iMono, k )
             if ( (iConst = Vec_IntEntry(vCoefs, iMono)) > 0 )
             {
@@ -771,12 +1063,16 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
             }
         //printf( "Obj %5d : nMonos = %6d  nUsed = %6d\n", iObj, nBuilds, nMonos );
     }
+    if ( pPar )
+        Gia_PolynParStop( pPar );
 
     // get the results
-    vPolyn = Gia_PolynGetResult( pHashC, pHashM, vCoefs );
-
-    printf( "HashC = %d. HashM = %d.  Total = %d. Left = %d.  Used = %d.  ", 
-        Hsh_VecSize(pHashC), Hsh_VecSize(pHashM), nBuilds, nMonos, Vec_WecSize(vPolyn)/2 );
+    if ( i == -1 )
+    {
+        vPolyn = Gia_PolynGetResult( pHashC, pHashM, vCoefs );
+        printf( "HashC = %d. HashM = %d.  Total = %d. Left = %d.  Used = %d.  ", 
+            Hsh_VecSize(pHashC), Hsh_VecSize(pHashM), nBuilds, nMonos, Vec_WecSize(vPolyn)/2 );
+    }
     Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
 
     for ( i = 0; i < 4; i++ )
@@ -801,7 +1097,7 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigned, int fVerbose, int fVeryVerbose )
+void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigned, int nThreads, int nMonoMax, int fVerbose, int fVeryVerbose )
 {
     Vec_Wec_t * vPolyn;
     Vec_Int_t * vRootLits = Vec_IntAlloc( Gia_ManCoNum(pGia) );
@@ -842,13 +1138,13 @@ void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigne
         else if ( Gia_ObjIsCo(pObj) )
             Vec_IntPush( vRootLits, Gia_ObjFaninLit0p(pGia, pObj) );
 
-    vPolyn = Gia_PolynBuildNew( pGia, vMonos, vRootLits, nExtra, vLeaves, vNodes, fSigned, fVerbose, fVeryVerbose );
+    vPolyn = Gia_PolynBuildNew( pGia, vMonos, vRootLits, nExtra, vLeaves, vNodes, fSigned, nThreads, nMonoMax, fVerbose, fVeryVerbose );
     //printf( "Polynomial has %d monomials.\n", Vec_WecSize(vPolyn)/2 );
-    if ( fVerbose || fVeryVerbose )
+    if ( vPolyn && (fVerbose || fVeryVerbose) )
         Gia_PolynPrintStats( vPolyn );
-    if ( fVeryVerbose )
+    if ( vPolyn && fVeryVerbose )
         Gia_PolynPrint( vPolyn );
-    Vec_WecFree( vPolyn );
+    Vec_WecFreeP( &vPolyn );
 
     Vec_IntFree( vRootLits );
     Vec_IntFree( vLeaves );
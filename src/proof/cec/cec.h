@@ -117,6 +117,7 @@ struct Cec_ParFra_t_
     int              fRunCSat;      // enable another solver
     int              fUseCones;     // use cones
     int              fUseOrigIds;   // enable recording of original IDs
+    int              fDirtyRefine;  // refines only the classes touched by counter-examples
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the failed output
@@ -152,6 +153,8 @@ struct Cec_ParCor_t_
     int              nBTLimit;      // conflict limit at a node
     int              nProcs;        // the number of processes
     int              nPartSize;     // the partition size
+    int              nPartIters;    // the max number of partitioned refinement rounds
+    int              fPartSmart;    // uses register-cone partitioning
     int              nLevelMax;     // (scorr only) the max number of levels
     int              nStepsMax;     // (scorr only) the max number of induction steps
     int              nLimitMax;     // (scorr only) stop after this many iterations if little or no improvement
@@ -810,6 +810,269 @@ references:
 
 
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the TFI of the node in the topological order.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSimCollectCone_rec( Gia_Man_t * p, int iObj, Vec_Int_t * vCone )
+{
+    Gia_Obj_t * pObj;
+    if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
+        return;
+    Gia_ObjSetTravIdCurrentId(p, iObj);
+    pObj = Gia_ManObj( p, iObj );
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        Cec_ManSimCollectCone_rec( p, Gia_ObjFaninId0(pObj, iObj), vCone );
+        Cec_ManSimCollectCone_rec( p, Gia_ObjFaninId1(pObj, iObj), vCone );
+    }
+    Vec_IntPush( vCone, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the nodes to be simulated for the dirty classes.]
+
+  Description [The dirty nodes are the nodes whose classes could be
+  refined by the new patterns (for example, the nodes disproved by the
+  SAT solver, which produced these patterns). The targets are all members
+  of the classes of the dirty nodes, or the dirty nodes themselves if they
+  are candidate constants. Returns the targets in vTargets and their TFI
+  (including the targets) in vCone sorted by object ID. Marks the classes
+  all of whose members are in the TFI in vComplete.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSimCollectDirty( Cec_ManSim_t * p, Vec_Int_t * vDirty, Vec_Int_t * vTargets, Vec_Int_t * vCone, Vec_Bit_t * vComplete )
+{
+    Gia_Man_t * pAig = p->pAig;
+    int i, iObj, iRepr, Ent;
+    Gia_ManIncrementTravId( pAig );
+    Vec_IntClear( vTargets );
+    Vec_IntClear( vCone );
+    Vec_IntForEachEntry( vDirty, iObj, i )
+    {
+        iRepr = Gia_ObjRepr( pAig, iObj );
+        if ( iRepr == 0 )
+        {
+            if ( !Gia_ObjIsTravIdCurrentId(pAig, iObj) )
+                Vec_IntPush( vTargets, iObj );
+            Cec_ManSimCollectCone_rec( pAig, iObj, vCone );
+            continue;
+        }
+        if ( iRepr == GIA_VOID )
+        {
+            if ( !Gia_ObjIsHead(pAig, iObj) )
+                continue;
+            iRepr = iObj;
+        }
+        if ( Vec_BitEntry(vComplete, iRepr) )
+            continue;
+        Vec_BitWriteEntry( vComplete, iRepr, 1 );
+        Gia_ClassForEachObj( pAig, iRepr, Ent )
+        {
+            if ( !Gia_ObjIsTravIdCurrentId(pAig, Ent) )
+                Vec_IntPush( vTargets, Ent );
+            Cec_ManSimCollectCone_rec( pAig, Ent, vCone );
+        }
+    }
+    Vec_IntSort( vCone, 0 );
+    // other classes are complete if all their members happen to be in the TFI
+    Vec_IntForEachEntry( vCone, iObj, i )
+    {
+        if ( !Gia_ObjIsHead(pAig, iObj) || Vec_BitEntry(vComplete, iObj) )
+            continue;
+        Gia_ClassForEachObj1( pAig, iObj, Ent )
+            if ( !Gia_ObjIsTravIdCurrentId(pAig, Ent) )
+                break;
+        if ( Ent == 0 )
+            Vec_BitWriteEntry( vComplete, iObj, 1 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one round for the dirty classes.]
+
+  Description [Works similarly to Cec_ManSimSimulateRound but only
+  simulates the TFI of the classes touched by the dirty nodes, and only
+  refines the classes all of whose members are in this TFI, as well as
+  the candidate constants in this TFI. The classes that cannot be changed
+  by the patterns are skipped without re-simulating their cones. Outputs
+  whose cones are not simulated are considered as not failed. Returns 1
+  if a failed output is found.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSimSimulateRoundDirty( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * vInfoCos, Vec_Int_t * vDirty )
+{
+    Gia_Man_t * pAig = p->pAig;
+    Vec_Int_t * vTargets = Vec_IntAlloc( 100 );
+    Vec_Int_t * vCone = Vec_IntAlloc( 1000 );
+    Vec_Bit_t * vComplete = Vec_BitStart( Gia_ManObjNum(pAig) );
+    Gia_Obj_t * pObj;
+    unsigned * pRes0, * pRes1, * pRes;
+    int i, k, w, Ent, iRepr;
+    assert( vInfoCis != NULL );
+    assert( !p->pPars->fSeqSimulate );
+    // prepare internal storage
+    if ( p->nWordsOld != p->nWords )
+        Cec_ManSimMemRelink( p );
+    p->nMemsMax = 0;
+    ABC_FREE( p->pScores );
+    Vec_IntClear( p->vRefinedC );
+    // collect the nodes and set the references from the nodes in the cone
+    Cec_ManSimCollectDirty( p, vDirty, vTargets, vCone, vComplete );
+    Vec_IntForEachEntry( vCone, i, k )
+        Gia_ManObj(pAig, i)->Value = 0;
+    Vec_IntForEachEntry( vCone, i, k )
+    {
+        pObj = Gia_ManObj( pAig, i );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        Gia_ObjFanin0(pObj)->Value++;
+        Gia_ObjFanin1(pObj)->Value++;
+    }
+    Gia_ManForEachCo( pAig, pObj, i )
+        if ( Gia_ObjIsTravIdCurrentId(pAig, Gia_ObjFaninId0p(pAig, pObj)) )
+            Gia_ObjFanin0(pObj)->Value++;
+    // the targets are referenced until the end of the round
+    Vec_IntForEachEntry( vTargets, i, k )
+        Gia_ManObj(pAig, i)->Value++;
+    // simulate nodes
+    Vec_IntForEachEntry( vCone, i, k )
+    {
+        pObj = Gia_ManObj( pAig, i );
+        pRes = Cec_ManSimSimRef( p, i );
+        if ( i == 0 )
+        {
+            for ( w = 1; w <= p->nWords; w++ )
+                pRes[w] = 0;
+            continue;
+        }
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            pRes0 = (unsigned *)Vec_PtrEntry( vInfoCis, Gia_ObjCioId(pObj) );
+            for ( w = 1; w <= p->nWords; w++ )
+                pRes[w] = pRes0[w-1];
+            // make sure the first pattern is always zero
+            pRes[1] ^= (pRes[1] & 1);
+        }
+        else
+        {
+            pRes0 = Cec_ManSimSimDeref( p, Gia_ObjFaninId0(pObj,i) );
+            pRes1 = Cec_ManSimSimDeref( p, Gia_ObjFaninId1(pObj,i) );
+            if ( Gia_ObjFaninC0(pObj) )
+            {
+                if ( Gia_ObjFaninC1(pObj) )
+                    for ( w = 1; w <= p->nWords; w++ )
+                        pRes[w] = ~(pRes0[w] | pRes1[w]);
+                else
+                    for ( w = 1; w <= p->nWords; w++ )
+                        pRes[w] = ~pRes0[w] & pRes1[w];
+            }
+            else
+            {
+                if ( Gia_ObjFaninC1(pObj) )
+                    for ( w = 1; w <= p->nWords; w++ )
+                        pRes[w] = pRes0[w] & ~pRes1[w];
+                else
+                    for ( w = 1; w <= p->nWords; w++ )
+                        pRes[w] = pRes0[w] & pRes1[w];
+            }
+        }
+        // if this node is candidate constant, collect it
+        if ( Gia_ObjIsConst(pAig, i) && !Cec_ManSimCompareConst(pRes + 1, p->nWords) )
+        {
+            pRes[0]++;
+            Vec_IntPush( p->vRefinedC, i );
+        }
+        if ( !Gia_ObjIsClass(pAig, i) )
+            continue;
+        iRepr = Gia_ObjIsHead(pAig, i) ? i : Gia_ObjRepr(pAig, i);
+        if ( !Vec_BitEntry(vComplete, iRepr) )
+            continue;
+        // if the node belongs to a complete class, save it
+        pRes[0]++;
+        // if this is the last node of the class, process it
+        if ( Gia_ObjIsTail(pAig, i) )
+        {
+            Vec_IntClear( p->vClassTemp );
+            Gia_ClassForEachObj( pAig, iRepr, Ent )
+                Vec_IntPush( p->vClassTemp, Ent );
+            Cec_ManSimClassRefineOne( p, iRepr );
+            Vec_IntForEachEntry( p->vClassTemp, Ent, w )
+                Cec_ManSimSimDeref( p, Ent );
+        }
+    }
+    // transfer the outputs whose cones are simulated
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        pRes = vInfoCos ? (unsigned *)Vec_PtrEntry( vInfoCos, i ) : NULL;
+        if ( !Gia_ObjIsTravIdCurrentId(pAig, Gia_ObjFaninId0p(pAig, pObj)) )
+        {
+            if ( pRes )
+                memset( pRes, 0, sizeof(unsigned) * p->nWords );
+            continue;
+        }
+        pRes0 = Cec_ManSimSimDeref( p, Gia_ObjFaninId0p(pAig, pObj) );
+        if ( pRes == NULL )
+            continue;
+        if ( Gia_ObjFaninC0(pObj) )
+            for ( w = 1; w <= p->nWords; w++ )
+                pRes[w-1] = ~pRes0[w];
+        else 
+            for ( w = 1; w <= p->nWords; w++ )
+                pRes[w-1] = pRes0[w];
+    }
+    // in the dual-output miter, the pairs with only one simulated output are not compared
+    if ( vInfoCos && p->pPars->fDualOut )
+    {
+        for ( i = 0; i + 1 < Gia_ManPoNum(pAig); i += 2 )
+            if ( Gia_ObjIsTravIdCurrentId(pAig, Gia_ObjFaninId0p(pAig, Gia_ManPo(pAig, i))) != 
+                 Gia_ObjIsTravIdCurrentId(pAig, Gia_ObjFaninId0p(pAig, Gia_ManPo(pAig, i+1))) )
+            {
+                memset( Vec_PtrEntry(vInfoCos, i),   0, sizeof(unsigned) * p->nWords );
+                memset( Vec_PtrEntry(vInfoCos, i+1), 0, sizeof(unsigned) * p->nWords );
+            }
+    }
+    if ( p->pPars->fConstCorr )
+    {
+        Vec_IntForEachEntry( p->vRefinedC, i, k )
+        {
+            Gia_ObjSetRepr( pAig, i, GIA_VOID );
+            Cec_ManSimSimDeref( p, i );
+        }
+        Vec_IntClear( p->vRefinedC );
+    }
+    if ( Vec_IntSize(p->vRefinedC) > 0 )
+        Cec_ManSimProcessRefined( p, p->vRefinedC );
+    Vec_IntForEachEntry( vTargets, i, k )
+        Cec_ManSimSimDeref( p, i );
+    assert( p->nMems == 1 );
+    if ( p->nMems != 1 )
+        Abc_Print( 1, "Cec_ManSimSimulateRoundDirty(): Memory management error!\n" );
+    if ( p->pPars->fVeryVerbose )
+        Gia_ManEquivPrintClasses( pAig, 0, Cec_MemUsage(p) );
+    Vec_IntFree( vTargets );
+    Vec_IntFree( vCone );
+    Vec_BitFree( vComplete );
+    return Cec_ManSimAnalyzeOutputs( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates simulation info for this round.]
@@ -187,6 +187,7 @@ void Cec_ManCorSetDefaultParams( Cec_ParCor_t * p )
     p->nRounds        =      15;  // the number of simulation rounds
     p->nFrames        =       1;  // the number of time frames
     p->nBTLimit       =     100;  // conflict limit at a node
+    p->nPartIters     =       1;  // the max number of partitioned refinement rounds
     p->nLevelMax      =      -1;  // (scorr only) the max number of levels
     p->nStepsMax      =      -1;  // (scorr only) the max number of induction steps
     p->fLatchCorr     =       0;  // consider only latch outputs
@@ -506,7 +506,7 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
         if ( nIterMax && nIter >= nIterMax )
             break;
     }
-    if ( Vec_PtrSize(vStack) == 0 )
+    if ( RetValue == -1 && Vec_PtrSize(vStack) == 0 )
         RetValue = 1;
     // finish
     Cec_GiaSplitClean( vStack );
@@ -528,9 +528,14 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Data structures of the work-stealing scheduler.]
 
-  Description []
+  Description [Each worker owns a queue of subproblems. It takes the 
+  deepest subproblem from its own queue and, when the queue is empty, 
+  steals the shallowest subproblem from the longest queue of another 
+  worker. When there is nothing to steal, the idle worker asks the worker
+  solving the shallowest subproblem to stop. The interrupted subproblem
+  is split by the owner, and the cofactors become available for stealing.]
                
   SideEffects []
 
@@ -538,47 +543,272 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
 
 ***********************************************************************/
 #define PAR_THR_MAX 100
+typedef struct Par_Share_t_ Par_Share_t;
+struct Par_Share_t_
+{
+    Vec_Ptr_t *     vQueues[PAR_THR_MAX]; // subproblems owned by each worker
+    int             Depths[PAR_THR_MAX];  // depth of the subproblem being solved (-1 if idle)
+    volatile int    Stops[PAR_THR_MAX];   // stop requests sent to the SAT solvers of the workers
+    int             nProcs;       // the number of workers
+    int             nBusy;        // the number of workers solving a subproblem
+    int             nIter;        // the number of case-splits
+    int             nIterMax;     // the limit on case-splits
+    int             LookAhead;    // cofactoring variable look-ahead
+    int             nTimeOut;     // timeout for one subproblem
+    int             fVerbose;     // verbose output
+    int             fVeryVerbose; // very verbose output
+    int             fStop;        // set when all workers should quit
+    int             RetValue;     // the result of solving
+    double          Progress;     // the fraction of the search space closed
+    Abc_Cex_t *     pCex;         // the counter-example
+    abctime         clkTotal;     // the starting time
+    pthread_mutex_t Mutex;        // protects the data above
+    pthread_cond_t  Cond;         // signals new subproblems or termination
+};
 typedef struct Par_ThData_t_
 {
-    Gia_Man_t * p;
-    Cnf_Dat_t * pCnf;
-    int         iThread;
-    int         nTimeOut;
-    int         fWorking;
-    int         Result;
-    int         nVars;
-    int         nConfs;
+    Par_Share_t *   pShare;
+    int             iThread;
 } Par_ThData_t;
+
+// the stop request of the worker running in this thread
+static ABC_THREAD_LOCAL volatile int * s_pSplitStop = NULL;
+int Cec_GiaSplitCallBackToStop( int RunId ) { return s_pSplitStop && *s_pSplitStop; }
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one subproblem while checking for stop requests.]
+
+  Description [The CNF is derived by the caller under the mutex because 
+  the CNF manager is shared.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cnf_GiaSolveOneStop( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut, int iThread, int * pnVars, int * pnConfs )
+{
+    int status;
+    sat_solver * pSat = Cec_GiaDeriveSolver( p, pCnf, nTimeOut );
+    if ( pSat == NULL )
+    {
+        *pnVars = 0;
+        *pnConfs = 0;
+        return 1;
+    }
+    sat_solver_set_runid( pSat, iThread );
+    sat_solver_set_stop_func( pSat, Cec_GiaSplitCallBackToStop );
+    status   = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    *pnVars  = sat_solver_nvars( pSat );
+    *pnConfs = sat_solver_nconflicts( pSat );
+    if ( status == l_True )
+        p->pCexComb = Cec_SplitDeriveModel( p, pCnf, pSat );
+    sat_solver_delete( pSat );
+    if ( status == l_Undef )
+        return -1;
+    if ( status == l_False )
+        return 1;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Scheduling procedures called with the mutex locked.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Gia_Man_t * Cec_GiaSplitGetJob( Par_Share_t * pShare, int iThread )
+{
+    Gia_Man_t * pJob;
+    int i, iBest = -1;
+    // take the last subproblem of this worker
+    if ( Vec_PtrSize(pShare->vQueues[iThread]) > 0 )
+        return (Gia_Man_t *)Vec_PtrPop( pShare->vQueues[iThread] );
+    // steal the first subproblem of the longest queue
+    for ( i = 0; i < pShare->nProcs; i++ )
+        if ( Vec_PtrSize(pShare->vQueues[i]) > 0 && (iBest == -1 || Vec_PtrSize(pShare->vQueues[i]) > Vec_PtrSize(pShare->vQueues[iBest])) )
+            iBest = i;
+    if ( iBest == -1 )
+        return NULL;
+    pJob = (Gia_Man_t *)Vec_PtrEntry( pShare->vQueues[iBest], 0 );
+    Vec_PtrDrop( pShare->vQueues[iBest], 0 );
+    return pJob;
+}
+static inline void Cec_GiaSplitRequestStop( Par_Share_t * pShare )
+{
+    int i, iBest = -1;
+    // skip if the previous request is not served yet
+    for ( i = 0; i < pShare->nProcs; i++ )
+        if ( pShare->Depths[i] >= 0 && pShare->Stops[i] )
+            return;
+    // interrupt the worker solving the largest subproblem
+    // (the root problem has already been tried before splitting)
+    for ( i = 0; i < pShare->nProcs; i++ )
+        if ( pShare->Depths[i] > 0 && (iBest == -1 || pShare->Depths[i] < pShare->Depths[iBest]) )
+            iBest = i;
+    if ( iBest >= 0 )
+        pShare->Stops[iBest] = 1;
+}
+static inline void Cec_GiaSplitStopAll( Par_Share_t * pShare )
+{
+    int i;
+    pShare->fStop = 1;
+    for ( i = 0; i < pShare->nProcs; i++ )
+        if ( pShare->Depths[i] >= 0 )
+            pShare->Stops[i] = 1;
+    pthread_cond_broadcast( &pShare->Cond );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the subproblem into two cofactors.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_GiaSplitCofactors( Gia_Man_t * pLast, int LookAhead, Gia_Man_t ** pParts, int * pnFanouts, int * pCost )
+{
+    int k, iVar = Gia_SplitCofVar( pLast, LookAhead, pnFanouts, pCost );
+    if ( pLast->vCofVars == NULL )
+        pLast->vCofVars = Vec_IntAlloc( 100 );
+    for ( k = 0; k < 2; k++ )
+    {
+        pParts[k] = Gia_ManDupCofactorVar( pLast, iVar, k );
+        pParts[k]->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
+        Vec_IntAppend( pParts[k]->vCofVars, pLast->vCofVars );
+        Vec_IntPush( pParts[k]->vCofVars, Abc_Var2Lit(iVar, !k) );
+    }
+    return iVar;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void * Cec_GiaSplitWorkerThread( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
+    Par_Share_t * pShare = pThData->pShare;
+    int iThread = pThData->iThread;
+    Gia_Man_t * pLast, * pParts[2];
+    Cnf_Dat_t * pCnf;
+    int Depth, status, nSatVars, nSatConfs;
+    s_pSplitStop = &pShare->Stops[iThread];
     while ( 1 )
     {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
+        // get the next subproblem
+        pthread_mutex_lock( &pShare->Mutex );
+        while ( !pShare->fStop && (pLast = Cec_GiaSplitGetJob(pShare, iThread)) == NULL )
         {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
+            if ( pShare->nBusy == 0 ) // all subproblems are solved
+            {
+                if ( pShare->RetValue == -1 )
+                    pShare->RetValue = 1;
+                Cec_GiaSplitStopAll( pShare );
+                break;
+            }
+            Cec_GiaSplitRequestStop( pShare );
+            pthread_cond_wait( &pShare->Cond, &pShare->Mutex );
+        }
+        if ( pShare->fStop )
+        {
+            pthread_mutex_unlock( &pShare->Mutex );
+            break;
         }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
-        pThData->fWorking = 0;
+        Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
+        pShare->Depths[iThread] = Depth;
+        pShare->nBusy++;
+        pShare->Stops[iThread] = 0;
+        pCnf = Cec_GiaDeriveGiaRemapped( pLast );
+        pthread_mutex_unlock( &pShare->Mutex );
+        // solve it
+        status = Cnf_GiaSolveOneStop( pLast, pCnf, pShare->nTimeOut, iThread, &nSatVars, &nSatConfs );
+        pthread_mutex_lock( &pShare->Mutex );
+        Cnf_DataFree( pCnf );
+        pthread_mutex_unlock( &pShare->Mutex );
+        // split the hard subproblem
+        pParts[0] = pParts[1] = NULL;
+        if ( status == -1 && !pShare->fStop )
+        {
+            int nFanouts, Cost, iVar = Cec_GiaSplitCofactors( pLast, pShare->LookAhead, pParts, &nFanouts, &Cost );
+            if ( pShare->fVeryVerbose )
+            {
+                pthread_mutex_lock( &pShare->Mutex );
+                printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
+                    iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pParts[0]) );
+                pthread_mutex_unlock( &pShare->Mutex );
+            }
+        }
+        // record the result
+        pthread_mutex_lock( &pShare->Mutex );
+        if ( status == 1 )
+            pShare->Progress += 1.0 / pow((double)2, (double)Depth);
+        if ( pShare->fVerbose && !pShare->fStop )
+            Cec_GiaSplitPrint( iThread+1, Depth, nSatVars, nSatConfs, status, pShare->Progress, Abc_Clock() - pShare->clkTotal );
+        if ( status == 0 && !pShare->fStop ) // SAT
+        {
+            pShare->pCex = pLast->pCexComb;  pLast->pCexComb = NULL;
+            pShare->RetValue = 0;
+            Cec_GiaSplitStopAll( pShare );
+        }
+        else if ( pParts[0] ) // UNDEC
+        {
+            Vec_PtrPush( pShare->vQueues[iThread], pParts[1] );
+            Vec_PtrPush( pShare->vQueues[iThread], pParts[0] );
+            pParts[0] = pParts[1] = NULL;
+            if ( ++pShare->nIter >= pShare->nIterMax && pShare->nIterMax )
+                Cec_GiaSplitStopAll( pShare );
+        }
+        pShare->Depths[iThread] = -1;
+        pShare->Stops[iThread] = 0;
+        pShare->nBusy--;
+        pthread_cond_broadcast( &pShare->Cond );
+        pthread_mutex_unlock( &pShare->Mutex );
+        Gia_ManStop( pLast );
     }
+    s_pSplitStop = NULL;
+    pthread_exit( NULL );
     assert( 0 );
     return NULL;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using the work-stealing scheduler.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
     pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack;
+    Par_Share_t Share, * pShare = &Share;
+    Gia_Man_t * pRoot, * pParts[2];
     Cnf_Dat_t * pCnf;
-    double Progress = 0;
-    int i, status, nSatVars, nSatConfs;
-    int nIter = 0, RetValue = -1, fWorkToDo = 1;
+    int i, Temp, status, nSatVars, nSatConfs, RetValue;
     Abc_CexFreeP( &p->pCexComb );
     if ( fVerbose )
         printf( "Solving CEC problem by cofactoring with the following parameters:\n" );
@@ -587,15 +817,13 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     fflush( stdout );
     if ( nProcs == 1 )
         return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
-    // subtract manager thread
-    nProcs--;
     assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
     // check the problem
     pCnf = Cec_GiaDeriveGiaRemapped( p );
     status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
     Cnf_DataFree( pCnf );
     if ( fVerbose && status != -1 )
-        Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
+        Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, 0, Abc_Clock() - clkTotal );
     if ( status == 0 )
     {
         if ( !fSilent )
@@ -609,119 +837,49 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
         return 1;
     }
     assert( status == -1 );
-    // create local copy
-    vStack = Vec_PtrAlloc( 1000 );
-    Vec_PtrPush( vStack, Gia_ManDup(p) );
-    // start threads
+    // start the shared data
+    memset( pShare, 0, sizeof(Par_Share_t) );
+    pShare->nProcs       = nProcs;
+    pShare->nIterMax     = nIterMax;
+    pShare->LookAhead    = LookAhead;
+    pShare->nTimeOut     = nTimeOut;
+    pShare->fVerbose     = fVerbose;
+    pShare->fVeryVerbose = fVeryVerbose;
+    pShare->RetValue     = -1;
+    pShare->clkTotal     = clkTotal;
+    pthread_mutex_init( &pShare->Mutex, NULL );
+    pthread_cond_init( &pShare->Cond, NULL );
     for ( i = 0; i < nProcs; i++ )
     {
-        ThData[i].p        = NULL;
-        ThData[i].pCnf     = NULL;
-        ThData[i].iThread  = i;
-        ThData[i].nTimeOut = nTimeOut;
-        ThData[i].fWorking = 0;
-        ThData[i].Result   = -1;
-        ThData[i].nVars    = -1;
-        ThData[i].nConfs   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        pShare->vQueues[i] = Vec_PtrAlloc( 100 );
+        pShare->Depths[i]  = -1;
+        pShare->Stops[i]   = 0;
     }
-    // look at the threads
-    while ( fWorkToDo )
+    // the root problem is undecided, so the workers start with its cofactors
+    pRoot = Gia_ManDup( p );
+    Cec_GiaSplitCofactors( pRoot, LookAhead, pParts, &Temp, &Temp );
+    Gia_ManStop( pRoot );
+    Vec_PtrPush( pShare->vQueues[0], pParts[1] );
+    Vec_PtrPush( pShare->vQueues[0], pParts[0] );
+    pShare->nIter = 1;
+    // start threads
+    for ( i = 0; i < nProcs; i++ )
     {
-        fWorkToDo = (int)(Vec_PtrSize(vStack) > 0);
-        for ( i = 0; i < nProcs; i++ )
-        {
-            // check if this thread is working
-            if ( ThData[i].fWorking )
-            {
-                fWorkToDo = 1;
-                continue;
-            }
-            // check if this thread has recently finished
-            if ( ThData[i].p != NULL )
-            {
-                Gia_Man_t * pLast = ThData[i].p;
-                int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
-                if ( pLast->vCofVars == NULL )
-                    pLast->vCofVars = Vec_IntAlloc( 100 );
-                if ( fVerbose )
-                    Cec_GiaSplitPrint( i+1, Depth, ThData[i].nVars, ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
-                if ( ThData[i].Result == 0 ) // SAT
-                {
-                    p->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
-                    RetValue = 0;
-                    goto finish;
-                }
-                if ( ThData[i].Result == -1 ) // UNDEC
-                {
-                    // determine cofactoring variable
-                    int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
-                    // cofactor
-                    Gia_Man_t * pPart = Gia_ManDupCofactorVar( pLast, iVar, 0 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // print results
-                    if ( fVeryVerbose )
-                    {
-//                        Cec_GiaSplitPrintRefs( pLast );
-                        printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
-                            iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
-//                        Cec_GiaSplitPrintRefs( pPart );
-                    }
-                    // cofactor
-                    pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // keep working
-                    fWorkToDo = 1;
-                    nIter++;
-                }
-                else
-                    Progress += 1.0 / pow((double)2, (double)Depth);
-                Gia_ManStopP( &ThData[i].p );
-                if ( ThData[i].pCnf == NULL )
-                    continue;
-                Cnf_DataFree( ThData[i].pCnf );
-                ThData[i].pCnf = NULL;
-            }
-            if ( Vec_PtrSize(vStack) == 0 )
-                continue;
-            // start a new thread
-            assert( ThData[i].p == NULL );
-            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
-            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
-            ThData[i].fWorking = 1;
-        }
-        if ( nIterMax && nIter >= nIterMax )
-            break;
+        ThData[i].pShare  = pShare;
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
-    if ( !fWorkToDo )
-        RetValue = 1;
-finish:
     // wait till threads finish
     for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = -1;
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        // cleanup
-        Gia_ManStopP( &ThData[i].p );
-        if ( ThData[i].pCnf == NULL )
-            continue;
-        Cnf_DataFree( ThData[i].pCnf );
-        ThData[i].pCnf = NULL;
-        // stop
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
-    }
+        pthread_join( WorkerThread[i], NULL );
+    RetValue = pShare->RetValue;
+    if ( RetValue == 0 )
+        p->pCexComb = pShare->pCex;
     // finish
-    Cec_GiaSplitClean( vStack );
+    for ( i = 0; i < nProcs; i++ )
+        Cec_GiaSplitClean( pShare->vQueues[i] );
+    pthread_mutex_destroy( &pShare->Mutex );
+    pthread_cond_destroy( &pShare->Cond );
     if ( !fSilent )
     {
         if ( RetValue == 0 )
@@ -731,7 +889,7 @@ finish:
         else if ( RetValue == -1 )
             printf( "Problem is UNDECIDED " );
         else assert( 0 );
-        printf( "after %d case-splits.  ", nIter );
+        printf( "after %d case-splits.  ", pShare->nIter );
         Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
         fflush( stdout );
     }
@@ -750,7 +908,6 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
         RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
-        Gia_ManStop( pOne );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
         {
@@ -758,6 +915,7 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
             pCex->iPo = i;
             RetValue = 0;
         }
+        Gia_ManStop( pOne );
         if ( RetValue1 == -1 )
             fOneUndef = 1;
     }
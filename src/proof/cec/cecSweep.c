@@ -195,7 +195,27 @@ clk = Abc_Clock();
     vInfo = Cec_ManPatCollectPatterns( pPat, Gia_ManCiNum(p->pAig), pSim->nWords );
 p->timePat += Abc_Clock() - clk;
 clk = Abc_Clock();
-    if ( vInfo != NULL )
+    if ( vInfo != NULL && p->pPars->fDirtyRefine )
+    {
+        // only the classes of the disproved nodes can be refined by these patterns
+        Vec_Int_t * vDirty = Vec_IntAlloc( 100 );
+        Gia_ManForEachCo( pNew, pObj, k )
+            if ( pObj->fMark0 )
+                Vec_IntPush( vDirty, Vec_IntEntry(p->vXorNodes, 2*k+1) );
+        for ( i = 0; i < pPat->nSeries; i++ )
+        {
+            Cec_ManFraCreateInfo( pSim, pSim->vCiSimInfo, vInfo, i );
+            if ( Cec_ManSimSimulateRoundDirty( pSim, pSim->vCiSimInfo, pSim->vCoSimInfo, vDirty ) )
+            {
+                Vec_IntFree( vDirty );
+                Vec_PtrFree( vInfo );
+                return 1;
+            }
+        }
+        Vec_IntFree( vDirty );
+        Vec_PtrFree( vInfo );
+    }
+    else if ( vInfo != NULL )
     {
         Gia_ManCreateValueRefs( p->pAig );
         for ( i = 0; i < pPat->nSeries; i++ )
@@ -60,6 +60,7 @@ struct Dch_Pars_t_
     abctime          timeSynth;     // synthesis runtime
     int              nNodesAhead;   // the lookahead in terms of nodes
     int              nCallsRecycle; // calls to perform before recycling SAT solver
+    int              nThreads;      // the number of threads sweeping the windows
 };
 
 ////////////////////////////////////////////////////////////////////////
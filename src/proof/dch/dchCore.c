@@ -57,6 +57,7 @@ void Dch_ManSetDefaultParams( Dch_Pars_t * p )
     p->fVerbose       =     0;  // verbose stats
     p->nNodesAhead    =  1000;  // the lookahead in terms of nodes
     p->nCallsRecycle  =   100;  // calls to perform before recycling SAT solver
+    p->nThreads       =     1;  // the number of threads sweeping the windows
 }
 
 /**Function*************************************************************
@@ -91,21 +92,27 @@ Aig_Man_t * Dch_ComputeChoices( Aig_Man_t * pAig, Dch_Pars_t * pPars )
     Dch_Man_t * p;
     Aig_Man_t * pResult;
     abctime clk, clk2 = Abc_Clock(), clkTotal = Abc_Clock();
-    // reset random numbers
-    Aig_ManRandom(1);
-    // start the choicing manager
-    p = Dch_ManCreate( pAig, pPars );
-    // compute candidate equivalence classes
+    // sweep the windows in parallel
+    if ( pPars->nThreads > 1 )
+        Dch_ManSweepPar( pAig, pPars );
+    else
+    {
+        // reset random numbers
+        Aig_ManRandom(1);
+        // start the choicing manager
+        p = Dch_ManCreate( pAig, pPars );
+        // compute candidate equivalence classes
 clk = Abc_Clock(); 
-    p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->fVerbose );
+        p->ppClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->fVerbose );
 p->timeSimInit = Abc_Clock() - clk;
 //    Dch_ClassesPrint( p->ppClasses, 0 );
-    p->nLits = Dch_ClassesLitNum( p->ppClasses );
-    // perform SAT sweeping
-    Dch_ManSweep( p );
-    // free memory ahead of time
+        p->nLits = Dch_ClassesLitNum( p->ppClasses );
+        // perform SAT sweeping
+        Dch_ManSweep( p );
+        // free memory ahead of time
 p->timeTotal = Abc_Clock() - clkTotal;
-    Dch_ManStop( p );
+        Dch_ManStop( p );
+    }
     if ( pPars->fVerbose ) 
         Abc_PrintTime( 1, "Old choice computation time", Abc_Clock() - clk2 );
     // create choices
@@ -137,6 +144,12 @@ void Dch_ComputeEquivalences( Aig_Man_t * pAig, Dch_Pars_t * pPars )
 {
     Dch_Man_t * p;
     abctime clk, clkTotal = Abc_Clock();
+    // sweep the windows in parallel
+    if ( pPars->nThreads > 1 )
+    {
+        Dch_ManSweepPar( pAig, pPars );
+        return;
+    }
     // reset random numbers
     Aig_ManRandom(1);
     // start the choicing manager
@@ -0,0 +1,425 @@
+/**CFile****************************************************************
+
+  FileName    [dchPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Choice computation for tech-mapping.]
+
+  Synopsis    [Windowed SAT sweeping using several threads.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "dchInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define DCH_PAR_MAX    64    // the max number of threads
+#define DCH_WIN_MIN  2000    // the min number of nodes in a window
+#define DCH_WIN_DEPTH  16    // the max depth of a window below its roots
+
+// the state shared by the threads sweeping the windows
+typedef struct Dch_ParMan_t_ Dch_ParMan_t;
+struct Dch_ParMan_t_
+{
+    Aig_Man_t *      pAig;           // the AIG whose equivalences are computed
+    Dch_Pars_t *     pPars;          // choicing parameters
+    Vec_Ptr_t *      vWins;          // the objects of each window
+    Vec_Ptr_t *      vProved;        // the pairs (node, repr) proved in each window
+    int              iNext;          // the next window to be swept
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;          // protects iNext and the AIG while windows are extracted
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the depth-limited TFI of the node.]
+
+  Description [The nodes whose level is not less than LevelMin become the
+  internal nodes of the window, the other nodes reached become its inputs.
+  The marks are stored in pMarks as 2*iWin+1 for the inputs and 2*iWin+2 
+  for the internal nodes of window iWin. Returns the number of new internal
+  nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dch_ParCollectTfi_rec( Aig_Man_t * p, Aig_Obj_t * pObj, int LevelMin, int iWin, int * pMarks, Vec_Int_t * vObjs )
+{
+    if ( pMarks[pObj->Id] == 2*iWin+2 )
+        return 0;
+    if ( !Aig_ObjIsNode(pObj) || (int)pObj->Level < LevelMin )
+    {
+        if ( pMarks[pObj->Id] != 2*iWin+1 )
+        {
+            pMarks[pObj->Id] = 2*iWin+1;
+            Vec_IntPush( vObjs, pObj->Id );
+        }
+        return 0;
+    }
+    if ( pMarks[pObj->Id] != 2*iWin+1 )
+        Vec_IntPush( vObjs, pObj->Id );
+    pMarks[pObj->Id] = 2*iWin+2;
+    return 1 + Dch_ParCollectTfi_rec( p, Aig_ObjFanin0(pObj), LevelMin, iWin, pMarks, vObjs ) 
+             + Dch_ParCollectTfi_rec( p, Aig_ObjFanin1(pObj), LevelMin, iWin, pMarks, vObjs );
+}
+int Dch_ParCollectTfi( Aig_Man_t * p, Aig_Obj_t * pObj, int iWin, int * pMarks, Vec_Int_t * vObjs )
+{
+    return Dch_ParCollectTfi_rec( p, pObj, (int)pObj->Level - DCH_WIN_DEPTH, iWin, pMarks, vObjs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the candidate equivalences into windows.]
+
+  Description [Computes candidate classes by random simulation and groups
+  them, in the order of their representatives, so that each group has at
+  least nWinSize internal nodes. The window of a group contains the TFI 
+  cones of its members, limited to DCH_WIN_DEPTH levels below each member.
+  The nodes on the boundary of the window become its free inputs, so the 
+  equivalences proved in the window hold in the AIG, while some of the 
+  equivalences may be missed. The cones of different windows may overlap.
+  Each window is returned as the array of its objects, whose literals are
+  complemented for the inputs. The partitioning does not depend on the 
+  number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Dch_ParDeriveWindows( Aig_Man_t * pAig, Dch_Pars_t * pPars, int nWinSize )
+{
+    Vec_Ptr_t * vWins = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vObjs = Vec_IntAlloc( 100 );
+    Vec_Wec_t * vClasses;
+    Dch_Cla_t * pClasses;
+    Aig_Obj_t * pObj, * pRepr;
+    int i, k, iObj, iMember, nNodes = 0;
+    int * pMarks = ABC_CALLOC( int, Aig_ManObjNumMax(pAig) );
+    // compute candidate classes
+    Aig_ManRandom( 1 );
+    pClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, 0 );
+    vClasses = Vec_WecStart( Aig_ManObjNumMax(pAig) );
+    Aig_ManForEachNode( pAig, pObj, i )
+        if ( (pRepr = Aig_ObjRepr(pAig, pObj)) && pRepr != Aig_ManConst1(pAig) )
+            Vec_WecPush( vClasses, pRepr->Id, pObj->Id );
+    // group the classes into windows
+    Aig_ManForEachObj( pAig, pObj, i )
+    {
+        if ( Aig_ObjIsCo(pObj) )
+            continue;
+        if ( !Dch_ObjIsConst1Cand(pAig, pObj) && Vec_IntSize(Vec_WecEntry(vClasses, i)) == 0 )
+            continue;
+        nNodes += Dch_ParCollectTfi( pAig, pObj, Vec_PtrSize(vWins), pMarks, vObjs );
+        Vec_IntForEachEntry( Vec_WecEntry(vClasses, i), iMember, k )
+            nNodes += Dch_ParCollectTfi( pAig, Aig_ManObj(pAig, iMember), Vec_PtrSize(vWins), pMarks, vObjs );
+        if ( nNodes < nWinSize )
+            continue;
+        Vec_IntForEachEntry( vObjs, iObj, k )
+            Vec_IntWriteEntry( vObjs, k, Abc_Var2Lit(iObj, pMarks[iObj] == 2*Vec_PtrSize(vWins)+1) );
+        Vec_IntSort( vObjs, 0 );
+        Vec_PtrPush( vWins, vObjs );
+        vObjs = Vec_IntAlloc( 100 );
+        nNodes = 0;
+    }
+    if ( Vec_IntSize(vObjs) )
+    {
+        Vec_IntForEachEntry( vObjs, iObj, k )
+            Vec_IntWriteEntry( vObjs, k, Abc_Var2Lit(iObj, pMarks[iObj] == 2*Vec_PtrSize(vWins)+1) );
+        Vec_IntSort( vObjs, 0 );
+        Vec_PtrPush( vWins, vObjs );
+    }
+    else
+        Vec_IntFree( vObjs );
+    ABC_FREE( pMarks );
+    Vec_WecFree( vClasses );
+    Dch_ClassesStop( pClasses );
+    Aig_ManReprStop( pAig );
+    return vWins;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Extracts the window as a standalone AIG.]
+
+  Description [Returns the mapping of window objects into the objects
+  of the original AIG.]
+
+  SideEffects [Uses the data fields of the AIG.]
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dch_ParExtractWindow( Aig_Man_t * pAig, Vec_Int_t * vObjs, Vec_Int_t ** pvMap )
+{
+    Aig_Man_t * pWin;
+    Vec_Int_t * vMap;
+    Aig_Obj_t * pObj, * pObjNew;
+    int i, iLit;
+    pWin = Aig_ManStart( Vec_IntSize(vObjs) );
+    vMap = Vec_IntStartFull( Vec_IntSize(vObjs) + 1 );
+    Vec_IntWriteEntry( vMap, 0, Aig_ManConst1(pAig)->Id );
+    Vec_IntForEachEntry( vObjs, iLit, i )
+    {
+        pObj = Aig_ManObj( pAig, Abc_Lit2Var(iLit) );
+        if ( Abc_LitIsCompl(iLit) )
+            pObj->pData = Aig_ObjIsConst1(pObj) ? Aig_ManConst1(pWin) : Aig_ObjCreateCi( pWin );
+        else
+            continue;
+        pObjNew = Aig_Regular((Aig_Obj_t *)pObj->pData);
+        if ( Vec_IntEntry(vMap, pObjNew->Id) == -1 )
+            Vec_IntWriteEntry( vMap, pObjNew->Id, pObj->Id );
+    }
+    Vec_IntForEachEntry( vObjs, iLit, i )
+    {
+        pObj = Aig_ManObj( pAig, Abc_Lit2Var(iLit) );
+        if ( Abc_LitIsCompl(iLit) )
+            continue;
+        pObj->pData = Aig_And( pWin, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        pObjNew = Aig_Regular((Aig_Obj_t *)pObj->pData);
+        if ( Vec_IntEntry(vMap, pObjNew->Id) == -1 )
+            Vec_IntWriteEntry( vMap, pObjNew->Id, pObj->Id );
+    }
+    Aig_ManSetRegNum( pWin, 0 );
+    *pvMap = vMap;
+    return pWin;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs SAT sweeping of one window.]
+
+  Description [Returns the pairs of objects of the original AIG, whose
+  equivalence was proved in the window.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Dch_ParSweepWindow( Aig_Man_t * pWin, Vec_Int_t * vMap, Dch_Pars_t * pPars )
+{
+    Vec_Int_t * vProved = Vec_IntAlloc( 100 );
+    Dch_Pars_t ParsWin = *pPars;
+    Dch_Man_t * p;
+    Aig_Obj_t * pObj, * pRepr;
+    int i;
+    ParsWin.fVerbose = 0;
+    Aig_ManRandom( 1 );
+    p = Dch_ManCreate( pWin, &ParsWin );
+    p->ppClasses = Dch_CreateCandEquivClasses( pWin, pPars->nWords, 0 );
+    p->nLits = Dch_ClassesLitNum( p->ppClasses );
+    Dch_ManSweep( p );
+    Dch_ManStop( p );
+    Aig_ManForEachObj( pWin, pObj, i )
+        if ( (pRepr = Aig_ObjRepr(pWin, pObj)) )
+        {
+            assert( Vec_IntEntry(vMap, pObj->Id) >= 0 && Vec_IntEntry(vMap, pRepr->Id) >= 0 );
+            Vec_IntPushTwo( vProved, Vec_IntEntry(vMap, pObj->Id), Vec_IntEntry(vMap, pRepr->Id) );
+        }
+    return vProved;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Extracts and sweeps one window.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ParSolveWindow( Dch_ParMan_t * p, int iWin )
+{
+    Aig_Man_t * pWin;
+    Vec_Int_t * vMap;
+    // windows are extracted one at a time because this uses the shared AIG
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    pWin = Dch_ParExtractWindow( p->pAig, (Vec_Int_t *)Vec_PtrEntry(p->vWins, iWin), &vMap );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    Vec_PtrWriteEntry( p->vProved, iWin, Dch_ParSweepWindow(pWin, vMap, p->pPars) );
+    Aig_ManStop( pWin );
+    Vec_IntFree( vMap );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the windows one at a time.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Dch_ParWorkerThread( void * pArg )
+{
+    Dch_ParMan_t * p = (Dch_ParMan_t *)pArg;
+    int iWin;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        iWin = p->iNext < Vec_PtrSize(p->vWins) ? p->iNext++ : -1;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iWin == -1 )
+            break;
+        Dch_ParSolveWindow( p, iWin );
+    }
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the representative in the union-find structure.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Dch_ParFind( int * pParents, int i )
+{
+    while ( pParents[i] != i )
+        i = pParents[i] = pParents[pParents[i]];
+    return i;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes equivalences by sweeping windows in parallel.]
+
+  Description [Partitions the candidate equivalences into windows, which
+  are swept independently by nThreads threads. The equivalences proved
+  in all windows are merged using union-find, in the order of windows,
+  and the object with the smallest ID becomes the representative of each
+  class. The result is recorded in pAig->pReprs, as after Dch_ManSweep(),
+  and does not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSweepPar( Aig_Man_t * pAig, Dch_Pars_t * pPars )
+{
+    Dch_ParMan_t Par, * p = &Par;
+    Vec_Int_t * vProved;
+    Vec_Int_t * vObjs;
+    int i, k, iObj, iRepr, nPairs = 0, nThreads;
+    int * pParents;
+    abctime clk = Abc_Clock();
+    memset( p, 0, sizeof(Dch_ParMan_t) );
+    p->pAig    = pAig;
+    p->pPars   = pPars;
+    p->vWins   = Dch_ParDeriveWindows( pAig, pPars, Abc_MaxInt(DCH_WIN_MIN, Aig_ManNodeNum(pAig) / DCH_PAR_MAX) );
+    p->vProved = Vec_PtrStart( Vec_PtrSize(p->vWins) );
+    nThreads   = Abc_MinInt( Abc_MinInt(pPars->nThreads, DCH_PAR_MAX), Vec_PtrSize(p->vWins) );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[DCH_PAR_MAX];
+        int status;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Dch_ParWorkerThread, (void *)p );  assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+    }
+    else
+#endif
+    for ( i = 0; i < Vec_PtrSize(p->vWins); i++ )
+        Dch_ParSolveWindow( p, i );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    // merge the equivalences proved in the windows
+    pParents = ABC_ALLOC( int, Aig_ManObjNumMax(pAig) );
+    for ( i = 0; i < Aig_ManObjNumMax(pAig); i++ )
+        pParents[i] = i;
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vProved, vProved, i )
+    {
+        Vec_IntForEachEntryDouble( vProved, iObj, iRepr, k )
+        {
+            iObj  = Dch_ParFind( pParents, iObj );
+            iRepr = Dch_ParFind( pParents, iRepr );
+            if ( iObj < iRepr )
+                pParents[iRepr] = iObj;
+            else if ( iObj > iRepr )
+                pParents[iObj] = iRepr;
+        }
+        nPairs += Vec_IntSize(vProved) / 2;
+        Vec_IntFree( vProved );
+    }
+    assert( pAig->pReprs == NULL );
+    Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
+    for ( i = 0; i < Aig_ManObjNumMax(pAig); i++ )
+        if ( Aig_ManObj(pAig, i) && (iRepr = Dch_ParFind(pParents, i)) != i )
+            pAig->pReprs[i] = Aig_ManObj( pAig, iRepr );
+    ABC_FREE( pParents );
+    if ( pPars->fVerbose )
+    {
+        printf( "Swept %d windows using %d threads.  Proved pairs = %d.  ", Vec_PtrSize(p->vWins), Abc_MaxInt(nThreads, 1), nPairs );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vWins, vObjs, i )
+        Vec_IntFree( vObjs );
+    Vec_PtrFree( p->vWins );
+    Vec_PtrFree( p->vProved );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -64,8 +64,12 @@ struct Inter_ManParams_t_
     int  fUseTwoFrames; // create the OR of two last timeframes
     int  fDropSatOuts;  // replace by 1 the solved outputs
     int  fDropInvar;    // dump inductive invariant into file
+    int  fUseIncr;      // reuse the solver with the timeframes across iterations
+    int  fCompact;      // compact interpolants using dc2
     int  fVerbose;      // print verbose statistics
     int  iFrameMax;     // the time frame reached
+    int  RunId;         // interpolation id in this run 
+    int(*pFuncStop)(int); // callback to terminate
     char * pFileName;   // file name to dump interpolant
 };
 
@@ -61,6 +61,8 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fUseSeparate  = 0;     // solve each output separately
     p->fUseTwoFrames = 0;     // create OR of two last timeframes
     p->fDropSatOuts  = 0;     // replace by 1 the solved outputs
+    p->fUseIncr      = 0;     // reuse the solver with the timeframes across iterations
+    p->fCompact      = 0;     // compact interpolants using dc2
     p->fVerbose      = 0;     // print verbose statistics
     p->iFrameMax     =-1;
 }
@@ -205,6 +207,15 @@ p->timeEqu += Abc_Clock() - clk;
                 Inter_CheckStop( pCheck );
                 return -1;
             }
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            { 
+                if ( pPars->fVerbose )
+                    printf( "Interpolation was cancelled by an external request.\n" );
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
 
             // perform interpolation
             clk = Abc_Clock();
@@ -216,6 +227,9 @@ p->timeEqu += Abc_Clock() - clk;
             }
             else 
 #endif
+            if ( pPars->fUseIncr && !pPars->fUseBackward )
+                RetValue = Inter_ManPerformOneStepIncr( p, pPars->fUseBias, nTimeNewOut );
+            else
                 RetValue = Inter_ManPerformOneStep( p, pPars->fUseBias, pPars->fUseBackward, nTimeNewOut );
 
             if ( pPars->fVerbose )
@@ -286,6 +300,11 @@ clk = Abc_Clock();
                 p->pInterNew = Dar_ManRwsat( pAigTemp = p->pInterNew, 1, 0 );
 //                p->pInterNew = Dar_ManRwsat( pAigTemp = p->pInterNew, 0, 0 );
                 Aig_ManStop( pAigTemp );
+                if ( p->pInterNew && pPars->fCompact )
+                {
+                    p->pInterNew = Dar_ManCompress2( pAigTemp = p->pInterNew, 1, 0, 1, 0, 0 );
+                    Aig_ManStop( pAigTemp );
+                }
                 if ( p->pInterNew == NULL )
                 {
                     printf( "Reached timeout (%d seconds) during rewriting.\n",  pPars->nSecLimit );
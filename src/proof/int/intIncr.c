@@ -0,0 +1,228 @@
+/**CFile****************************************************************
+
+  FileName    [intIncr.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Interpolation with the persistent proof-logging solver.]
+
+  Author      [agent <agent@local>]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "intInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the persistent SAT solver for the current timeframes.]
+
+  Description [The clauses of the timeframes are loaded first and marked
+  as clauses of A, followed by the clauses of one timeframe of the
+  transition relation and the connectors. The solver and the clause store
+  are bookmarked at this point, so that only the clauses of the current
+  interpolant are reloaded in each iteration. Returns 0 if the clauses
+  are UNSAT without the interpolant.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManIncrStart( Inter_Man_t * p )
+{
+    sat_solver * pSat;
+    Aig_Obj_t * pObj, * pObj2;
+    int i, Lits[2], RetValue = 1;
+    int nVarsFrames = p->pCnfFrames->nVars;
+    assert( p->pSatIncr == NULL );
+    assert( Aig_ManCoNum(p->pFrames) == 1 );
+    // start the solver
+    pSat = sat_solver_new();
+    sat_solver_store_alloc( pSat );
+    sat_solver_setnvars( pSat, nVarsFrames + p->pCnfAig->nVars );
+    // add clauses of A (timeframes)
+    for ( i = 0; i < p->pCnfFrames->nClauses; i++ )
+        if ( !sat_solver_addclause( pSat, p->pCnfFrames->pClauses[i], p->pCnfFrames->pClauses[i+1] ) )
+        {
+            sat_solver_delete( pSat );
+            return 0;
+        }
+    sat_solver_store_mark_clauses_a( pSat );
+    // add clauses of one timeframe
+    Cnf_DataLift( p->pCnfAig, nVarsFrames );
+    for ( i = 0; RetValue && i < p->pCnfAig->nClauses; i++ )
+        RetValue = sat_solver_addclause( pSat, p->pCnfAig->pClauses[i], p->pCnfAig->pClauses[i+1] );
+    // connector clauses
+    Vec_IntClear( p->vVarsAB );
+    Aig_ManForEachCi( p->pFrames, pObj, i )
+    {
+        if ( i == Aig_ManRegNum(p->pAigTrans) )
+            break;
+        Vec_IntPush( p->vVarsAB, p->pCnfFrames->pVarNums[pObj->Id] );
+
+        pObj2 = Saig_ManLi( p->pAigTrans, i );
+        Lits[0] = toLitCond( p->pCnfFrames->pVarNums[pObj->Id], 0 );
+        Lits[1] = toLitCond( p->pCnfAig->pVarNums[pObj2->Id], 1 );
+        if ( RetValue )
+            RetValue = sat_solver_addclause( pSat, Lits, Lits+2 );
+        Lits[0] = toLitCond( p->pCnfFrames->pVarNums[pObj->Id], 1 );
+        Lits[1] = toLitCond( p->pCnfAig->pVarNums[pObj2->Id], 0 );
+        if ( RetValue )
+            RetValue = sat_solver_addclause( pSat, Lits, Lits+2 );
+    }
+    Cnf_DataLift( p->pCnfAig, -nVarsFrames );
+    if ( !RetValue || !sat_solver_simplify(pSat) )
+    {
+        sat_solver_delete( pSat );
+        return 0;
+    }
+    sat_solver_bookmark( pSat );
+    Sto_ManBookmark( (Sto_Man_t *)pSat->pStore );
+    p->pSatIncr  = pSat;
+    p->nVarsIncr = nVarsFrames + p->pCnfAig->nVars;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the persistent SAT solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Inter_ManIncrStop( Inter_Man_t * p )
+{
+    if ( p->pSatIncr == NULL )
+        return;
+    sat_solver_delete( p->pSatIncr );
+    p->pSatIncr  = NULL;
+    p->nVarsIncr = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one SAT run with interpolation.]
+
+  Description [Same as Inter_ManPerformOneStep() but reuses the solver
+  containing the timeframes. Because the timeframes are the clauses of A,
+  the interpolant I computed by the proof satisfies Frames => I and
+  I & Inter & Trans = 0, and its complement is used as the image.
+  Returns 1 if proven. 0 if failed. -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformOneStepIncr( Inter_Man_t * p, int fUseBias, abctime nTimeNewOut )
+{
+    sat_solver * pSat;
+    Inta_Man_t * pManInterA;
+    Aig_Obj_t * pObj, * pObj2;
+    int * pGlobalVars;
+    int i, Var, Lits[2], status, RetValue = 1;
+    ABC_INT64_T nConfStart;
+    abctime clk;
+
+    // derive the SAT solver
+    if ( p->pSatIncr == NULL && !Inter_ManIncrStart(p) )
+        return Inter_ManPerformOneStep( p, fUseBias, 0, nTimeNewOut );
+    pSat = p->pSatIncr;
+    // skip implications left after the last conflict or failed clause
+    pSat->qhead = pSat->qtail;
+    sat_solver_rollback( pSat );
+    Sto_ManRollback( (Sto_Man_t *)pSat->pStore );
+
+    // add clauses of the interpolant
+    Cnf_DataLift( p->pCnfInter, p->nVarsIncr );
+    sat_solver_setnvars( pSat, p->nVarsIncr + p->pCnfInter->nVars );
+    for ( i = 0; RetValue && i < p->pCnfInter->nClauses; i++ )
+        RetValue = sat_solver_addclause( pSat, p->pCnfInter->pClauses[i], p->pCnfInter->pClauses[i+1] );
+    // connect it with the register outputs
+    Aig_ManForEachCi( p->pInter, pObj, i )
+    {
+        pObj2 = Saig_ManLo( p->pAigTrans, i );
+        Var = p->pCnfFrames->nVars + p->pCnfAig->pVarNums[pObj2->Id];
+        Lits[0] = toLitCond( p->pCnfInter->pVarNums[pObj->Id], 0 );
+        Lits[1] = toLitCond( Var, 1 );
+        if ( RetValue )
+            RetValue = sat_solver_addclause( pSat, Lits, Lits+2 );
+        Lits[0] = toLitCond( p->pCnfInter->pVarNums[pObj->Id], 1 );
+        Lits[1] = toLitCond( Var, 0 );
+        if ( RetValue )
+            RetValue = sat_solver_addclause( pSat, Lits, Lits+2 );
+    }
+    Cnf_DataLift( p->pCnfInter, -p->nVarsIncr );
+    if ( !RetValue )
+    {
+        p->pInterNew = NULL;
+        return 1;
+    }
+    sat_solver_store_mark_roots( pSat );
+
+    // set runtime limit
+    if ( nTimeNewOut )
+        sat_solver_set_runtime_limit( pSat, nTimeNewOut );
+
+    // collect global variables
+    pGlobalVars = ABC_CALLOC( int, sat_solver_nvars(pSat) );
+    Vec_IntForEachEntry( p->vVarsAB, Var, i )
+        pGlobalVars[Var] = 1;
+    pSat->pGlobalVars = fUseBias? pGlobalVars : NULL;
+
+    // solve the problem
+clk = Abc_Clock();
+    nConfStart = pSat->stats.conflicts;
+    status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)p->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    p->nConfCur = (int)(pSat->stats.conflicts - nConfStart);
+p->timeSat += Abc_Clock() - clk;
+
+    pSat->pGlobalVars = NULL;
+    ABC_FREE( pGlobalVars );
+    if ( status == l_True )
+        return 0;
+    if ( status != l_False )
+        return -1;
+
+    // create the resulting manager
+clk = Abc_Clock();
+    pManInterA = Inta_ManAlloc();
+    p->pInterNew = (Aig_Man_t *)Inta_ManInterpolate( pManInterA, (Sto_Man_t *)pSat->pStore, nTimeNewOut, p->vVarsAB, 0 );
+    Inta_ManFree( pManInterA );
+p->timeInt += Abc_Clock() - clk;
+    if ( p->pInterNew == NULL )
+        return -1;
+    Aig_ObjChild0Flip( Aig_ManCo(p->pInterNew, 0) );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
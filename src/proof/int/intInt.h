@@ -61,6 +61,9 @@ struct Inter_Man_t_
     Cnf_Dat_t *      pCnfFrames;   // CNF for the timeframes 
     // other data
     Vec_Int_t *      vVarsAB;      // the variables participating in 
+    // persistent solver
+    sat_solver *     pSatIncr;     // the solver with the timeframes
+    int              nVarsIncr;    // the number of variables before the interpolant
     // temporary place for the new interpolant
     Aig_Man_t *      pInterNew;
     Vec_Ptr_t *      vInters;
@@ -117,6 +120,11 @@ extern Inter_Man_t *   Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pP
 extern void            Inter_ManClean( Inter_Man_t * p );
 extern void            Inter_ManStop( Inter_Man_t * p, int fProved );
 
+/*=== intIncr.c ============================================================*/
+extern int             Inter_ManIncrStart( Inter_Man_t * p );
+extern void            Inter_ManIncrStop( Inter_Man_t * p );
+extern int             Inter_ManPerformOneStepIncr( Inter_Man_t * p, int fUseBias, abctime nTimeNewOut );
+
 /*=== intM114.c ============================================================*/
 extern int             Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, int fUseBackward, abctime nTimeNewOut );
 
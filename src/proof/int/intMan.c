@@ -80,6 +80,7 @@ void Inter_ManClean( Inter_Man_t * p )
             Aig_ManStop( pMan );
         Vec_PtrClear( p->vInters );
     }
+    Inter_ManIncrStop( p );
     if ( p->pCnfInter )
         Cnf_DataFree( p->pCnfInter );
     if ( p->pCnfFrames )
@@ -126,6 +126,12 @@ struct Pdr_Man_t_
     int         nCexesTotal;
     // terminary simulation
     Txs3_Man_t * pTxs3;      
+    Gia_Tsm_t *  pTsm;       // bit-parallel ternary simulator
+    Vec_Int_t *  vAig2Gia;   // mapping of AIG object IDs into GIA object IDs
+    Vec_Int_t *  vTsmCis;    // cone leaves (GIA object IDs)
+    Vec_Int_t *  vTsmCos;    // cone roots (GIA object IDs)
+    Vec_Int_t *  vTsmCands;  // candidate flops (GIA object IDs)
+    Vec_Int_t *  vTsmDrops;  // flops that can be dropped individually
     // internal use
     Vec_Int_t * vPrio;     // priority flops
     Vec_Int_t * vLits;     // array of literals
@@ -251,7 +251,14 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p = ABC_CALLOC( Pdr_Man_t, 1 );
     p->pPars    = pPars;
     p->pAig     = pAig;
-    p->pGia     = (pPars->fFlopPrio || p->pPars->fNewXSim || p->pPars->fUseAbs) ? Gia_ManFromAigSimple(pAig) : NULL;
+    p->pGia     = (pPars->fFlopPrio || p->pPars->fNewXSim || p->pPars->fBitXSim || p->pPars->fUseAbs) ? Gia_ManFromAigSimple(pAig) : NULL;
+    if ( pPars->fBitXSim )
+    {
+        Aig_Obj_t * pObj; int i;
+        p->vAig2Gia = Vec_IntStartFull( Aig_ManObjNumMax(pAig) );
+        Aig_ManForEachObj( pAig, pObj, i )
+            Vec_IntWriteEntry( p->vAig2Gia, i, Abc_Lit2Var(pObj->iData) );
+    }
     p->vSolvers = Vec_PtrAlloc( 0 );
     p->vClauses = Vec_VecAlloc( 0 );
     p->pQueue   = NULL;
@@ -282,6 +289,11 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->pCnfMan  = Cnf_ManStart();
     // ternary simulation
     p->pTxs3    = pPars->fNewXSim ? Txs3_ManStart( p, pAig, p->vPrio ) : NULL;
+    p->pTsm     = pPars->fBitXSim ? Gia_TsmStart( p->pGia, 4 ) : NULL;
+    p->vTsmCis   = Vec_IntAlloc( 100 );  // cone leaves
+    p->vTsmCos   = Vec_IntAlloc( 100 );  // cone roots
+    p->vTsmCands = Vec_IntAlloc( 100 );  // candidate flops
+    p->vTsmDrops = Vec_IntAlloc( 100 );  // flops that can be dropped
     // additional AIG data-members
     if ( pAig->pFanData == NULL )
         Aig_ManFanoutStart( pAig );
@@ -320,6 +332,8 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Pdr_Set_t * pCla;
     sat_solver * pSat;
     int i, k;
+    if ( p->pTsm )
+        Gia_TsmStop( p->pTsm );
     Gia_ManStopP( &p->pGia );
     Aig_ManCleanMarkAB( p->pAig );
     if ( p->pPars->fVerbose ) 
@@ -370,6 +384,11 @@ void Pdr_ManStop( Pdr_Man_t * p )
     // terminary simulation
     if ( p->pPars->fNewXSim )
         Txs3_ManStop( p->pTxs3 );
+    Vec_IntFreeP( &p->vAig2Gia );
+    Vec_IntFree( p->vTsmCis );
+    Vec_IntFree( p->vTsmCos );
+    Vec_IntFree( p->vTsmCands );
+    Vec_IntFree( p->vTsmDrops );
     // internal use
     Vec_IntFreeP( &p->vPrio   );  // priority flops
     Vec_IntFree( p->vLits     );  // array of literals
@@ -331,6 +331,44 @@ void Pdr_ManPrintCex( Aig_Man_t * pAig, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals
     ABC_FREE( pBuff );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Marks flops that cannot be removed using bit-parallel simulation.]
+
+  Description [Each candidate flop is made X in a pattern of its own,
+  so that all flops in the cone are tested at the same time. A flop
+  that cannot be made X individually cannot be removed by the greedy
+  procedure below either, because ternary simulation is monotone.
+  Such flops are marked with fMarkB.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManTernaryFilter( Pdr_Man_t * p, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vCoObjs )
+{
+    Aig_Obj_t * pObj;
+    int i, Entry;
+    Vec_IntClear( p->vTsmCis );
+    Vec_IntClear( p->vTsmCos );
+    Vec_IntClear( p->vTsmCands );
+    Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+    {
+        Vec_IntPush( p->vTsmCis, Vec_IntEntry(p->vAig2Gia, Aig_ObjId(pObj)) );
+        if ( Saig_ObjIsLo(p->pAig, pObj) )
+            Vec_IntPush( p->vTsmCands, Vec_IntEntry(p->vAig2Gia, Aig_ObjId(pObj)) );
+    }
+    Vec_IntForEachEntry( vCoObjs, Entry, i )
+        Vec_IntPush( p->vTsmCos, Vec_IntEntry(p->vAig2Gia, Entry) );
+    Gia_TsmFindDrops( p->pTsm, p->vTsmCis, vCiVals, p->vTsmCos, p->vTsmCands, p->vTsmDrops );
+    Entry = 0;
+    Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+        if ( Saig_ObjIsLo(p->pAig, pObj) )
+            pObj->fMarkB = !Vec_IntEntry( p->vTsmDrops, Entry++ );
+    assert( Entry == Vec_IntSize(p->vTsmDrops) );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Shrinks values using ternary simulation.]
@@ -403,6 +441,9 @@ if ( p->pPars->fVeryVerbose )
 Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
     RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, NULL );
     assert( RetValue );
+    // mark flops that cannot be removed
+    if ( p->pTsm )
+        Pdr_ManTernaryFilter( p, vCiObjs, vCiVals, vCoObjs );
 
     // iteratively remove flops
     if ( p->pPars->fFlopPrio )
@@ -424,6 +465,8 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
         {
             pObj = Aig_ManCi( p->pAig, Saig_ManPiNum(p->pAig) + Entry );
             assert( Saig_ObjIsLo( p->pAig, pObj ) );
+            if ( pObj->fMarkB )
+                continue;
             Vec_IntClear( vUndo );
             if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
                 Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
@@ -440,7 +483,7 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
             if ( !Saig_ObjIsLo( p->pAig, pObj ) )
                 continue;
             Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
-            if ( Vec_IntEntry(vPrio, Entry) )
+            if ( Vec_IntEntry(vPrio, Entry) || pObj->fMarkB )
                 continue;
             Vec_IntClear( vUndo );
             if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
@@ -454,7 +497,7 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
             if ( !Saig_ObjIsLo( p->pAig, pObj ) )
                 continue;
             Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
-            if ( !Vec_IntEntry(vPrio, Entry) )
+            if ( !Vec_IntEntry(vPrio, Entry) || pObj->fMarkB )
                 continue;
             Vec_IntClear( vUndo );
             if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
@@ -464,6 +507,10 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
         }
     }
 
+    if ( p->pTsm )
+        Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+            pObj->fMarkB = 0;
+
 if ( p->pPars->fVeryVerbose )
 Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, vCi2Rem );
     RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, vCi2Rem );
@@ -42,6 +42,8 @@ struct Ssw_Pars_t_
 {
     int              nPartSize;     // size of the partition
     int              nOverSize;     // size of the overlap between partitions
+    int              nPartIters;    // the max number of partitioned refinement rounds
+    int              fPartSmart;    // uses register-cone partitioning
     int              nProcs;        // the number of processors
     int              nFramesK;      // the induction depth
     int              nFramesAddSim; // the number of additional frames to simulate
@@ -98,6 +100,7 @@ struct Ssw_RarPars_t_
     int              nRounds;
     int              nRestart;
     int              nRandSeed;
+    int              nProcs;
     int              TimeOut;
     int              TimeOutGap;
     int              fSolveAll;
@@ -202,35 +202,23 @@ void Ssw_SignalCorrespondenceArray( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
 
 /**Function*************************************************************
 
-  Synopsis    [Performs partitioned sequential SAT sweeping.]
+  Synopsis    [Derives register partitions for one round.]
 
-  Description []
+  Description [Large clock domains are divided into separate partitions.
+  Otherwise, the registers are either clustered by their structural
+  support (register cones with implicit overlap), or split into chunks
+  of the given size with the given overlap.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
+Vec_Ptr_t * Ssw_ManPartitionRegs( Aig_Man_t * pAig, Ssw_Pars_t * pPars, int nPartSize )
 {
-    int fPrintParts = 1;
-    char Buffer[100];
-    Aig_Man_t * pTemp, * pNew;
     Vec_Ptr_t * vResult;
     Vec_Int_t * vPart;
-    int * pMapBack;
-    int i, nCountPis, nCountRegs;
-    int nClasses, nPartSize, fVerbose;
-    abctime clk = Abc_Clock();
-    if ( pPars->fConstrs )
-    {
-        Abc_Print( 1, "Cannot use partitioned computation with constraints.\n" );
-        return NULL;
-    }
-    // save parameters
-    nPartSize = pPars->nPartSize; pPars->nPartSize = 0;
-    fVerbose  = pPars->fVerbose;  pPars->fVerbose  = 0;
-    // generate partitions
+    int i;
     if ( pAig->vClockDoms )
     {
         // divide large clock domains into separate partitions
@@ -243,87 +231,205 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
                 Vec_PtrPush( vResult, Vec_IntDup(vPart) );
         }
     }
+    else if ( pPars->fPartSmart )
+        vResult = Aig_ManRegPartitionSmart( pAig, nPartSize, 0 );
     else
         vResult = Aig_ManRegPartitionSimple( pAig, nPartSize, pPars->nOverSize );
-//    vResult = Aig_ManPartitionSmartRegisters( pAig, nPartSize, 0 ); 
-//    vResult = Aig_ManRegPartitionSmart( pAig, nPartSize );
-    if ( fPrintParts )
+    return vResult;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Union-find over the objects of the original AIG.]
+
+  Description [The root of each set is the object with the smallest ID,
+  which is always a valid representative for the other objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Ssw_ManReprFind( Vec_Int_t * vParents, int iObj )
+{
+    while ( Vec_IntEntry(vParents, iObj) != iObj )
     {
-        // print partitions
-        Abc_Print( 1, "Simple partitioning. %d partitions are saved:\n", Vec_PtrSize(vResult) );
-        Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
-        {
-//            extern void Ioa_WriteAiger( Aig_Man_t * pMan, char * pFileName, int fWriteSymbols, int fCompact );
-            sprintf( Buffer, "part%03d.aig", i );
-            pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, NULL );
-            Ioa_WriteAiger( pTemp, Buffer, 0, 0 );
-            Abc_Print( 1, "part%03d.aig : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d.\n",
-                i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp) );
-            Aig_ManStop( pTemp );
-        }
+        Vec_IntWriteEntry( vParents, iObj, Vec_IntEntry(vParents, Vec_IntEntry(vParents, iObj)) );
+        iObj = Vec_IntEntry( vParents, iObj );
     }
+    return iObj;
+}
+static inline void Ssw_ManReprUnion( Vec_Int_t * vParents, int iObj0, int iObj1 )
+{
+    iObj0 = Ssw_ManReprFind( vParents, iObj0 );
+    iObj1 = Ssw_ManReprFind( vParents, iObj1 );
+    if ( iObj0 < iObj1 )
+        Vec_IntWriteEntry( vParents, iObj1, iObj0 );
+    else if ( iObj1 < iObj0 )
+        Vec_IntWriteEntry( vParents, iObj0, iObj1 );
+}
 
-    // perform SSW with partitions
+/**Function*************************************************************
+
+  Synopsis    [Adds the classes proved in one partition.]
+
+  Description [Unlike Aig_TransferMappedClasses(), which overwrites the
+  representative, the equivalences coming from overlapping partitions 
+  are accumulated, so that classes split across partitions are joined.
+  This is sound because each partition treats the registers outside of
+  it as free inputs. Returns the number of proved equivalences.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_ManReprCollect( Vec_Int_t * vParents, Aig_Man_t * pPart, int * pMapBack )
+{
+    Aig_Obj_t * pObj;
+    int k, nClasses = 0;
+    if ( pPart->pReprs == NULL )
+        return 0;
+    Aig_ManForEachObj( pPart, pObj, k )
+    {
+        if ( pPart->pReprs[pObj->Id] == NULL )
+            continue;
+        assert( pMapBack[pObj->Id] >= 0 && pMapBack[pPart->pReprs[pObj->Id]->Id] >= 0 );
+        Ssw_ManReprUnion( vParents, pMapBack[pObj->Id], pMapBack[pPart->pReprs[pObj->Id]->Id] );
+        nClasses++;
+    }
+    return nClasses;
+}
+int Ssw_ManReprDerive( Aig_Man_t * pAig, Vec_Int_t * vParents )
+{
+    Aig_Obj_t * pObj;
+    int i, iRepr, nMerged = 0;
     Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
+    Aig_ManForEachObj( pAig, pObj, i )
+    {
+        iRepr = Ssw_ManReprFind( vParents, i );
+        if ( iRepr == i )
+            continue;
+        pAig->pReprs[i] = Aig_ManObj( pAig, iRepr );
+        nMerged++;
+    }
+    return nMerged;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of partitioned sequential SAT sweeping.]
+
+  Description [Partitions are solved one by one, or concurrently using
+  the array-based &scorr if fThreads is set. The resulting classes are
+  merged and the reduced AIG is returned.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Ssw_SignalCorrespondencePartRound( Aig_Man_t * pAig, Ssw_Pars_t * pPars, int nPartSize, int fThreads, int fVerbose, int * pnMerged )
+{
+    Aig_Man_t * pTemp, * pNew;
+    Vec_Ptr_t * vResult, * vAigs, * vMaps, * vGias = NULL;
+    Vec_Int_t * vPart, * vParents;
+    Gia_Man_t * pGia;
+    int * pMapBack;
+    int i, nCountPis, nCountRegs, nClasses;
+    abctime clk = Abc_Clock();
+    // generate partitions
+    vResult = Ssw_ManPartitionRegs( pAig, pPars, nPartSize );
+    if ( fVerbose )
+        Abc_Print( 1, "%s partitioning. %d partitions are derived:\n", pPars->fPartSmart ? "Register-cone" : "Simple", Vec_PtrSize(vResult) );
+    // collect partitions
+    vAigs = Vec_PtrAlloc( Vec_PtrSize(vResult) );
+    vMaps = Vec_PtrAlloc( Vec_PtrSize(vResult) );
+    if ( fThreads )
+        vGias = Vec_PtrAlloc( Vec_PtrSize(vResult) );
     Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
     {
         pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack );
         Aig_ManSetRegNum( pTemp, pTemp->nRegs );
+        Vec_PtrPush( vAigs, pTemp );
+        Vec_PtrPush( vMaps, pMapBack );
+        if ( fVerbose )
+            Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d.\n",
+                i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp) );
+        if ( vGias )
+        {
+            Vec_PtrPush( vGias, Gia_ManFromAigSimple(pTemp) );
+            continue;
+        }
         // create the projection of 1-hot registers
         if ( pAig->vOnehots )
             pTemp->vOnehots = Aig_ManRegProjectOnehots( pAig, pTemp, pAig->vOnehots, fVerbose );
         // run SSW
-        if (nCountPis>0) {
-            pNew = Ssw_SignalCorrespondence( pTemp, pPars );
-            nClasses = Aig_TransferMappedClasses( pAig, pTemp, pMapBack );
-            if ( fVerbose )
-                Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
-                    i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp), pPars->nIters, nClasses );
-            Aig_ManStop( pNew );
+        if ( nCountPis > 0 )
+            Aig_ManStop( Ssw_SignalCorrespondence( pTemp, pPars ) );
+    }
+    // solve partitions concurrently
+    if ( vGias )
+        Ssw_SignalCorrespondenceArray( vGias, pPars );
+    // merge the classes
+    nClasses = 0;
+    vParents = Vec_IntStartNatural( Aig_ManObjNumMax(pAig) );
+    Vec_PtrForEachEntry( Aig_Man_t *, vAigs, pTemp, i )
+    {
+        pMapBack = (int *)Vec_PtrEntry( vMaps, i );
+        if ( vGias )
+        {
+            Aig_Man_t * pTemp2;
+            pGia   = (Gia_Man_t *)Vec_PtrEntry( vGias, i );
+            pTemp2 = Gia_ManToAigSimple( pGia );
+            Gia_ManReprToAigRepr2( pTemp2, pGia );
+            nClasses += Ssw_ManReprCollect( vParents, pTemp2, pMapBack );
+            Aig_ManStop( pTemp2 );
+            Gia_ManStop( pGia );
         }
+        else
+            nClasses += Ssw_ManReprCollect( vParents, pTemp, pMapBack );
         Aig_ManStop( pTemp );
         ABC_FREE( pMapBack );
     }
+    *pnMerged = Ssw_ManReprDerive( pAig, vParents );
+    Vec_IntFree( vParents );
     // remap the AIG
     pNew = Aig_ManDupRepr( pAig, 0 );
     Aig_ManSeqCleanup( pNew );
-//    Aig_ManPrintStats( pAig );
-//    Aig_ManPrintStats( pNew );
-    Vec_VecFree( (Vec_Vec_t *)vResult );
-    pPars->nPartSize = nPartSize;
-    pPars->fVerbose = fVerbose;
     if ( fVerbose )
     {
-        ABC_PRT( "Total time", Abc_Clock() - clk );
+        Abc_Print( 1, "Parts = %4d. Proved = %6d. Merged = %6d. Reg = %6d -> %6d. And = %7d -> %7d. ", 
+            Vec_PtrSize(vResult), nClasses, *pnMerged, Aig_ManRegNum(pAig), Aig_ManRegNum(pNew), Aig_ManNodeNum(pAig), Aig_ManNodeNum(pNew) );
+        ABC_PRT( "Time", Abc_Clock() - clk );
     }
+    if ( vGias )
+        Vec_PtrFree( vGias );
+    Vec_PtrFree( vAigs );
+    Vec_PtrFree( vMaps );
+    Vec_VecFree( (Vec_Vec_t *)vResult );
     return pNew;
 }
 
-
 /**Function*************************************************************
 
   Synopsis    [Performs partitioned sequential SAT sweeping.]
 
-  Description []
+  Description [Iterates rounds of partitioning, solving, and merging 
+  until no new equivalences are found or the round limit is reached.
+  Each round re-partitions the reduced AIG, so that equivalences whose
+  proof needs registers from different partitions may be found later.
+  The classes of the first round are left in pAig->pReprs.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
+Aig_Man_t * Ssw_SignalCorrespondencePartInt( Aig_Man_t * pAig, Ssw_Pars_t * pPars, int fThreads )
 {
-    int fPrintParts = 1;
-    //char Buffer[100];
     Aig_Man_t * pTemp, * pNew;
-    Vec_Ptr_t * vAigs;    
-    Vec_Ptr_t * vGias;
-    Vec_Ptr_t * vMaps;
-    Vec_Ptr_t * vResult;
-    Vec_Int_t * vPart;
-    int * pMapBack = NULL;
-    int i, nCountPis, nCountRegs;
-    int nClasses, nPartSize, fVerbose;
+    int i, nMerged, nPartSize, fVerbose;
     abctime clk = Abc_Clock();
     if ( pPars->fConstrs )
     {
@@ -333,73 +439,12 @@ Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars
     // save parameters
     nPartSize = pPars->nPartSize; pPars->nPartSize = 0;
     fVerbose  = pPars->fVerbose;  pPars->fVerbose  = 0;
-    // generate partitions
-    if ( pAig->vClockDoms )
+    pNew = Ssw_SignalCorrespondencePartRound( pAig, pPars, nPartSize, fThreads, fVerbose, &nMerged );
+    for ( i = 1; i < pPars->nPartIters && nMerged > 0 && Aig_ManRegNum(pNew) > 0; i++ )
     {
-        // divide large clock domains into separate partitions
-        vResult = Vec_PtrAlloc( 100 );
-        Vec_PtrForEachEntry( Vec_Int_t *, (Vec_Ptr_t *)pAig->vClockDoms, vPart, i )
-        {
-            if ( nPartSize && Vec_IntSize(vPart) > nPartSize )
-                Aig_ManPartDivide( vResult, vPart, nPartSize, pPars->nOverSize );
-            else
-                Vec_PtrPush( vResult, Vec_IntDup(vPart) );
-        }
-    }
-    else
-        vResult = Aig_ManRegPartitionSimple( pAig, nPartSize, pPars->nOverSize );
-//    vResult = Aig_ManPartitionSmartRegisters( pAig, nPartSize, 0 ); 
-//    vResult = Aig_ManRegPartitionSmart( pAig, nPartSize );
-    // collect partitions
-    vAigs = Vec_PtrAlloc( 100 );
-    vGias = Vec_PtrAlloc( 100 );
-    vMaps = Vec_PtrAlloc( 100 );
-    if ( fPrintParts )
-        Abc_Print( 1, "Simple partitioning. %d partitions are saved:\n", Vec_PtrSize(vResult) );
-    Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
-    {
-        pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack );
-        Aig_ManSetRegNum( pTemp, pTemp->nRegs );
-        Vec_PtrPush( vAigs, pTemp );
-        Vec_PtrPush( vGias, Gia_ManFromAigSimple(pTemp) );
-        Vec_PtrPush( vMaps, pMapBack );
-        //sprintf( Buffer, "part%03d.aig", i );
-        //Ioa_WriteAiger( pTemp, Buffer, 0, 0 );
-        if ( fPrintParts )
-            Abc_Print( 1, "part%03d.aig : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d.\n",
-                i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp) );
-    }
-    // solve partitions
-    Ssw_SignalCorrespondenceArray( vGias, pPars );
-    // collect the results
-    Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
-    Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
-    {
-        int * pMapBack = (int *)Vec_PtrEntry( vMaps, i );
-        Gia_Man_t * pGia = (Gia_Man_t *)Vec_PtrEntry( vGias, i );
-        Aig_Man_t * pTemp2 = Gia_ManToAigSimple( pGia );
-        pTemp = (Aig_Man_t *)Vec_PtrEntry( vAigs, i );
-        Gia_ManReprToAigRepr2( pTemp2, pGia );
-        // remap back
-        nClasses = Aig_TransferMappedClasses( pAig, pTemp2, pMapBack );
-        if ( fVerbose )
-            Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
-                i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), 0, 0, Aig_ManNodeNum(pTemp), 0, nClasses );
+        pNew = Ssw_SignalCorrespondencePartRound( pTemp = pNew, pPars, nPartSize, fThreads, fVerbose, &nMerged );
         Aig_ManStop( pTemp );
-        Aig_ManStop( pTemp2 );
-        Gia_ManStop( pGia );
-        ABC_FREE( pMapBack );
     }
-    Vec_PtrFree( vAigs );
-    Vec_PtrFree( vGias );
-    Vec_PtrFree( vMaps );
-
-    // remap the AIG
-    pNew = Aig_ManDupRepr( pAig, 0 );
-    Aig_ManSeqCleanup( pNew );
-//    Aig_ManPrintStats( pAig );
-//    Aig_ManPrintStats( pNew );
-    Vec_VecFree( (Vec_Vec_t *)vResult );
     pPars->nPartSize = nPartSize;
     pPars->fVerbose = fVerbose;
     if ( fVerbose )
@@ -408,6 +453,15 @@ Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars
     }
     return pNew;
 }
+Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
+{
+    return Ssw_SignalCorrespondencePartInt( pAig, pPars, 0 );
+}
+Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
+{
+    return Ssw_SignalCorrespondencePartInt( pAig, pPars, 1 );
+}
+
 void Gia_ManRestoreNodeMapping( Aig_Man_t * pAig, Gia_Man_t * pGia )
 {
     Aig_Obj_t * pObjAig; int i;
@@ -427,6 +481,8 @@ Gia_Man_t * Gia_SignalCorrespondencePart( Gia_Man_t * p, Cec_ParCor_t * pPars )
     pSswPars->nBTLimit  = pPars->nBTLimit;
     pSswPars->nProcs    = pPars->nProcs;
     pSswPars->nPartSize = pPars->nPartSize;
+    pSswPars->nPartIters= pPars->nPartIters;
+    pSswPars->fPartSmart= pPars->fPartSmart;
     pSswPars->fVerbose  = pPars->fVerbose;
     pNew = Ssw_SignalCorrespondencePart2( pAig, pSswPars );
     Gia_ManRestoreNodeMapping( pAig, p );
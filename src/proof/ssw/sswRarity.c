@@ -23,6 +23,17 @@
 #include "base/main/main.h"
 #include "sat/bmc/bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -115,6 +126,7 @@ void Ssw_RarSetDefaultParams( Ssw_RarPars_t * p )
     p->fSetLastState =   0;
     p->fVerbose      =   0;
     p->fNotVerbose   =   0;
+    p->nProcs        =   1;
 }
 
 /**Function*************************************************************
@@ -658,7 +670,8 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
     Ssw_RarManInitialize( p, vInit );
     Vec_PtrClear( p->vUpdConst );
     Vec_PtrClear( p->vUpdClass );
-    Aig_ManIncrementTravId( p->pAig );
+    if ( fUpdate )
+        Aig_ManIncrementTravId( p->pAig );
     // check comb inputs
     if ( fUpdate )
     Aig_ManForEachCi( p->pAig, pObj, i )
@@ -959,6 +972,242 @@ int Ssw_RarCheckTrivial( Aig_Man_t * pAig, int fVerbose )
     return 0;
 }
 
+#ifdef ABC_USE_PTHREADS
+
+#define RAR_THR_MAX 100
+
+typedef struct Ssw_RarShare_t_ Ssw_RarShare_t;
+struct Ssw_RarShare_t_
+{
+    Aig_Man_t *      pAig;         // user's AIG (read-only while workers are running)
+    Ssw_RarPars_t *  pPars;        // user's parameters
+    int *            pRarity;      // merged rarity counters
+    int              nRarity;      // the number of counters
+    int              nMerges;      // the number of merges
+    int              nRoundsAll;   // the total number of rounds
+    int              nActive;      // the number of running workers
+    volatile int     fStop;        // global stop flag
+    Abc_Cex_t *      pCex;         // the first counter-example found
+    int              iWinner;      // the worker that found it
+    abctime          clkTotal;     // starting time
+    abctime          nTimeToStop;  // runtime limit
+    pthread_mutex_t  Mutex;        // protects the data above
+};
+
+typedef struct Ssw_RarThData_t_ Ssw_RarThData_t;
+struct Ssw_RarThData_t_
+{
+    Ssw_RarShare_t * pShare;       // shared data
+    Ssw_RarPars_t    Pars;         // private copy of parameters
+    int              iThread;      // worker ID
+    int              nRounds;      // rounds of this worker
+    int *            pSnap;        // rarity counters after the last merge
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Merges rarity counters of one worker with the shared ones.]
+
+  Description [The increments accumulated by the worker since the last
+  merge are added to the shared counters, and the worker continues with
+  the merged counters. This way, every worker biases its patterns towards
+  the states that are rare across all workers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ssw_RarMergeRarity( Ssw_RarShare_t * pShare, Ssw_RarMan_t * p, int * pSnap )
+{
+    int i;
+    pthread_mutex_lock( &pShare->Mutex );
+    for ( i = 0; i < pShare->nRarity; i++ )
+    {
+        pShare->pRarity[i] += p->pRarity[i] - pSnap[i];
+        p->pRarity[i] = pSnap[i] = pShare->pRarity[i];
+    }
+    pShare->nMerges++;
+    pthread_mutex_unlock( &pShare->Mutex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rarity simulation performed by one worker.]
+
+  Description [Each worker has its own simulation manager and its own
+  stream of random numbers, seeded differently for different workers.
+  Since the random number generator is thread-local, the counter-example
+  is derived by the worker that found it, after other workers have
+  stopped using the shared AIG.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Ssw_RarWorkerThread( void * pArg )
+{
+    Ssw_RarThData_t * pThData = (Ssw_RarThData_t *)pArg;
+    Ssw_RarShare_t * pShare = pThData->pShare;
+    Ssw_RarPars_t * pPars = &pThData->Pars;
+    Aig_Man_t * pAig = pShare->pAig;
+    Ssw_RarMan_t * p;
+    int r, f, nNumRestart = 0;
+    int nSavedSeed = pPars->nRandSeed;
+    Ssw_RarManPrepareRandom( nSavedSeed );
+    p = Ssw_RarManStart( pAig, pPars );
+    p->vInits = Vec_IntStart( Aig_ManRegNum(pAig) * pPars->nWords );
+    for ( r = 0; !pThData->nRounds || (nNumRestart * pPars->nRestart + r < pThData->nRounds); r++ )
+    {
+        for ( f = 0; f < pPars->nFrames; f++ )
+        {
+            if ( pShare->fStop )
+                goto finish;
+            if ( pShare->nTimeToStop && Abc_Clock() > pShare->nTimeToStop )
+                goto finish;
+            if ( pPars->TimeOutGap && Abc_Clock() > pShare->clkTotal + pPars->TimeOutGap * CLOCKS_PER_SEC )
+                goto finish;
+            Ssw_RarManSimulate( p, f ? NULL : p->vInits, 0, 0 );
+            if ( !Ssw_RarManCheckNonConstOutputs(p, r * pPars->nFrames + f, Abc_Clock() - pShare->clkTotal) )
+                continue;
+            // claim the win
+            pthread_mutex_lock( &pShare->Mutex );
+            if ( pShare->fStop )
+            {
+                pthread_mutex_unlock( &pShare->Mutex );
+                goto finish;
+            }
+            pShare->fStop = 1;
+            pShare->iWinner = pThData->iThread;
+            pShare->nActive--;
+            pthread_mutex_unlock( &pShare->Mutex );
+            // wait till other workers stop reading the AIG
+            while ( 1 )
+            {
+                int nActive;
+                pthread_mutex_lock( &pShare->Mutex );
+                nActive = pShare->nActive;
+                pthread_mutex_unlock( &pShare->Mutex );
+                if ( nActive == 0 )
+                    break;
+                sched_yield();
+            }
+            Ssw_RarManPrepareRandom( nSavedSeed );
+            pShare->pCex = Ssw_RarDeriveCex( p, r * pPars->nFrames + f, p->iFailPo, p->iFailPat, pPars->fVerbose );
+            pthread_mutex_lock( &pShare->Mutex );
+            pShare->nRoundsAll += nNumRestart * pPars->nRestart + r;
+            pthread_mutex_unlock( &pShare->Mutex );
+            Ssw_RarManStop( p );
+            return NULL;
+        }
+        if ( pPars->nRestart && r == pPars->nRestart )
+        {
+            r = -1;
+            nSavedSeed = (nSavedSeed + pShare->pPars->nProcs) % 1000;
+            Ssw_RarManPrepareRandom( nSavedSeed );
+            Vec_IntFill( p->vInits, Aig_ManRegNum(pAig) * pPars->nWords, 0 );
+            nNumRestart++;
+            Vec_IntClear( p->vPatBests );
+        }
+        else
+        {
+            Ssw_RarTransferPatterns( p, p->vInits );
+            Ssw_RarMergeRarity( pShare, p, pThData->pSnap );
+        }
+    }
+finish:
+    pthread_mutex_lock( &pShare->Mutex );
+    pShare->nRoundsAll += nNumRestart * pPars->nRestart + r;
+    pShare->nActive--;
+    pthread_mutex_unlock( &pShare->Mutex );
+    Ssw_RarManStop( p );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sharded rarity simulation using several threads.]
+
+  Description [Workers simulate independent rarity-biased pattern batches,
+  periodically merge their rarity counters, and stop as soon as one of them
+  finds a counter-example. The limit on the number of rounds (if given)
+  is divided among the workers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_RarSimulatePar( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
+{
+    Ssw_RarThData_t ThData[RAR_THR_MAX];
+    pthread_t WorkerThread[RAR_THR_MAX];
+    Ssw_RarShare_t Share, * pShare = &Share;
+    int i, status, nProcs = Abc_MinInt( pPars->nProcs, RAR_THR_MAX );
+    assert( nProcs > 1 && !pPars->fSolveAll );
+    ABC_FREE( pAig->pSeqModel );
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Rarity simulation with %d threads, %d words, %d frames, %d rounds, %d restart, %d seed, and %d sec timeout.\n",
+            nProcs, pPars->nWords, pPars->nFrames, pPars->nRounds, pPars->nRestart, pPars->nRandSeed, pPars->TimeOut );
+    memset( pShare, 0, sizeof(Ssw_RarShare_t) );
+    pShare->pAig        = pAig;
+    pShare->pPars       = pPars;
+    pShare->nRarity     = (1 << pPars->nBinSize) * (Aig_ManRegNum(pAig) / pPars->nBinSize);
+    pShare->pRarity     = ABC_CALLOC( int, pShare->nRarity );
+    pShare->nActive     = nProcs;
+    pShare->iWinner     = -1;
+    pShare->clkTotal    = Abc_Clock();
+    pShare->nTimeToStop = pPars->TimeOut ? pPars->TimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    status = pthread_mutex_init( &pShare->Mutex, NULL );  assert( status == 0 );
+    pPars->nSolved = 0;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pShare         = pShare;
+        ThData[i].Pars           = *pPars;
+        ThData[i].Pars.nRandSeed = (pPars->nRandSeed + i) % 1000;
+        ThData[i].Pars.fVerbose  = 0;
+        ThData[i].iThread        = i;
+        ThData[i].nRounds        = pPars->nRounds ? Abc_MaxInt( 1, (pPars->nRounds + nProcs - 1) / nProcs ) : 0;
+        ThData[i].pSnap          = ABC_CALLOC( int, pShare->nRarity );
+        status = pthread_create( WorkerThread + i, NULL, Ssw_RarWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pthread_join( WorkerThread[i], NULL );
+        ABC_FREE( ThData[i].pSnap );
+    }
+    pthread_mutex_destroy( &pShare->Mutex );
+    ABC_FREE( pShare->pRarity );
+    if ( pShare->pCex )
+    {
+        pAig->pSeqModel = pShare->pCex;
+        pPars->nSolved = 1;
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Worker %d found the counter-example after %d rounds in total (%d merges of rarity counters).\n", pShare->iWinner, pShare->nRoundsAll, pShare->nMerges );
+        if ( !pPars->fSilent )
+        {
+            Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", pAig->pSeqModel->iPo, pAig->pName, pAig->pSeqModel->iFrame );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - pShare->clkTotal );
+        }
+        return 0;
+    }
+    if ( !pPars->fSilent )
+    {
+        Abc_Print( 1, "Simulation of %d frames for %d rounds by %d threads did not assert POs.  ", pPars->nFrames, pShare->nRoundsAll, nProcs );
+        if ( pPars->TimeOut && Abc_Clock() > pShare->nTimeToStop )
+            Abc_Print( 1, "Reached timeout (%d sec).  ",  pPars->TimeOut );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - pShare->clkTotal );
+    }
+    return -1;
+}
+
+#else // pthreads are not used
+
+int Ssw_RarSimulatePar( Aig_Man_t * pAig, Ssw_RarPars_t * pPars ) { return -2; }
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Perform sequential simulation.]
@@ -985,6 +1234,13 @@ int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
     int iFrameFail = -1;
     assert( Aig_ManRegNum(pAig) > 0 );
     assert( Aig_ManConstrNum(pAig) == 0 );
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll && !pPars->fSetLastState )
+    {
+        RetValue = Ssw_RarSimulatePar( pAig, pPars );
+        if ( RetValue != -2 )
+            return RetValue;
+        RetValue = -1;
+    }
     ABC_FREE( pAig->pSeqModel );
     // consider the case of empty AIG
 //    if ( Aig_ManNodeNum(pAig) == 0 )
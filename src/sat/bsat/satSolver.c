@@ -1642,11 +1642,36 @@ void sat_solver_reducedb(sat_solver* s)
 void sat_solver_rollback( sat_solver* s )
 {
     Sat_Mem_t * pMem = &s->Mem;
+    clause * c;
     int i, k, j;
+    int iPageStart = pMem->BookMarkH[1] ? Sat_MemHandPage(pMem, pMem->BookMarkH[1]) : 1;
+    int kStart     = pMem->BookMarkH[1] ? Sat_MemHandShift(pMem, pMem->BookMarkH[1]) : 2;
     static int Count = 0;
     Count++;
     assert( s->iVarPivot >= 0 && s->iVarPivot <= s->size );
     assert( s->iTrailPivot >= 0 && s->iTrailPivot <= s->qtail );
+    // remove watches of two-literal learned clauses added after the bookmark
+    // (these are watched as literals and would otherwise survive compaction)
+    for ( i = iPageStart; i <= pMem->iPage[1]; i += 2 )
+    for ( k = (i == iPageStart ? kStart : 2); k < Sat_MemLimit(pMem->pPages[i]) && ((c) = Sat_MemClause(pMem, i, k)); k += Sat_MemClauseSize(c) )
+    {
+        if ( c->size != 2 )
+            continue;
+        assert( !Sat_MemClauseUsed(pMem, Sat_MemHand(pMem, i, k)) );
+        for ( j = 0; j < 2; j++ )
+        {
+            veci * pWatch = &s->wlists[lit_neg(c->lits[j])];
+            cla * pArray = veci_begin(pWatch), Entry = clause_from_lit(c->lits[!j]);
+            int w, nSize = veci_size(pWatch);
+            if ( lit_neg(c->lits[j]) >= s->iVarPivot*2 )
+                continue;
+            for ( w = 0; w < nSize && pArray[w] != Entry; w++ );
+            for ( ; w < nSize - 1; w++ )
+                pArray[w] = pArray[w+1];
+            if ( w < nSize )
+                veci_resize( pWatch, nSize - 1 );
+        }
+    }
     // reset implication queue
     sat_solver_canceluntil_rollback( s, s->iTrailPivot );
     // update order 
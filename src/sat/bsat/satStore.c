@@ -265,6 +265,62 @@ void Sto_ManMarkClausesA( Sto_Man_t * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Remembers the current set of clauses.]
+
+  Description [Should be called before the empty clause is added.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sto_ManBookmark( Sto_Man_t * p )
+{
+    assert( p->pEmpty == NULL );
+    p->pTailMark    = p->pTail;
+    p->pChunkMark   = p->pChunkLast;
+    p->nChunkMark   = p->nChunkUsed;
+    p->nClausesMark = p->nClauses;
+    p->nVarsMark    = p->nVars;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the clauses added after the bookmark.]
+
+  Description [Memory chunks allocated after the bookmark are released.
+  The marking of root clauses and clauses of A is left unchanged if it
+  was done before the bookmark.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sto_ManRollback( Sto_Man_t * p )
+{
+    char * pMem, * pNext;
+    for ( pMem = p->pChunkLast; pMem != p->pChunkMark; pMem = pNext )
+    {
+        pNext = *(char **)pMem;
+        ABC_FREE( pMem );
+    }
+    p->pChunkLast = p->pChunkMark;
+    p->nChunkUsed = p->nChunkMark;
+    p->pTail      = p->pTailMark;
+    if ( p->pTail )
+        p->pTail->pNext = NULL;
+    else
+        p->pHead = NULL;
+    p->pEmpty     = NULL;
+    p->nClauses   = p->nClausesMark;
+    p->nVars      = p->nVarsMark;
+    p->nRoots     = Abc_MinInt( p->nRoots, p->nClauses );
+    p->nClausesA  = Abc_MinInt( p->nClausesA, p->nClauses );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns the literal of the last clause.]
@@ -93,6 +93,12 @@ struct Sto_Man_t_
     int             nChunkSize;   // the number of bytes in a chunk
     int             nChunkUsed;   // the number of bytes used in the last chunk
     char *          pChunkLast;   // the last memory chunk
+    // bookmark
+    Sto_Cls_t *     pTailMark;    // the tail clause at the bookmark
+    char *          pChunkMark;   // the last memory chunk at the bookmark
+    int             nChunkMark;   // the number of bytes used in this chunk
+    int             nClausesMark; // the number of clauses at the bookmark
+    int             nVarsMark;    // the number of variables at the bookmark
 };
 
 // iterators through the clauses
@@ -116,6 +122,8 @@ extern void         Sto_ManMarkRoots( Sto_Man_t * p );
 extern void         Sto_ManMarkClausesA( Sto_Man_t * p );
 extern void         Sto_ManDumpClauses( Sto_Man_t * p, char * pFileName );
 extern int          Sto_ManChangeLastClause( Sto_Man_t * p );
+extern void         Sto_ManBookmark( Sto_Man_t * p );
+extern void         Sto_ManRollback( Sto_Man_t * p );
 extern Sto_Man_t *  Sto_ManLoadClauses( char * pFileName );
 
 
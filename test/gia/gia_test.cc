@@ -51,4 +51,37 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, CanTernarySimulateAnAndGate) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+
+  int and_output = Gia_ManAppendAnd(aig_manager, input1, input2);
+  int output = Gia_ManAppendCo(aig_manager, and_output);
+
+  Gia_Tsm_t* ternary_sim = Gia_TsmStart(aig_manager, 1);
+  // pattern 0: A = X, B = 0 -> A & B == 0
+  // pattern 1: A = X, B = 1 -> A & B == X
+  Gia_TsmSetCi(ternary_sim, Abc_Lit2Var(input1), GIA_UND);
+  Gia_TsmSetCiPat(ternary_sim, Abc_Lit2Var(input2), 0, GIA_ZER);
+  Gia_TsmSetCiPat(ternary_sim, Abc_Lit2Var(input2), 1, GIA_ONE);
+  Gia_TsmSimulate(ternary_sim, NULL);
+
+  EXPECT_EQ(Gia_TsmObjValue(ternary_sim, Abc_Lit2Var(output), 0), GIA_ZER);
+  EXPECT_EQ(Gia_TsmObjValue(ternary_sim, Abc_Lit2Var(output), 1), GIA_UND);
+
+  // incrementally set A = 1: pattern 1 becomes 1
+  Vec_Int_t* changed = Vec_IntAlloc(1);
+  Vec_IntPush(changed, Abc_Lit2Var(input1));
+  Gia_TsmSetCi(ternary_sim, Abc_Lit2Var(input1), GIA_ONE);
+  Gia_TsmSimulateTfo(ternary_sim, changed);
+
+  EXPECT_EQ(Gia_TsmObjValue(ternary_sim, Abc_Lit2Var(output), 0), GIA_ZER);
+  EXPECT_EQ(Gia_TsmObjValue(ternary_sim, Abc_Lit2Var(output), 1), GIA_ONE);
+  Vec_IntFree(changed);
+  Gia_TsmStop(ternary_sim);
+  Gia_ManStop(aig_manager);
+}
+
 ABC_NAMESPACE_IMPL_END